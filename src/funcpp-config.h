@@ -0,0 +1,31 @@
+/**
+ * @file
+ *
+ * @brief Build configuration of Functional C++
+ *
+ * Included in the global module fragment of the modules that
+ * need it.
+ */
+#ifndef FUNCPP_CONFIG_H
+#define FUNCPP_CONFIG_H
+
+/**
+ * @def FUNCPP_POSTCONDITION(...)
+ *
+ * @brief Asserts the post-condition of a type constructor
+ *
+ * Expands to `static_assert(__VA_ARGS__)`.
+ *
+ * The constructors of this library produce well-formed types by
+ * construction. Their post-conditions only guard against mistakes in
+ * the library itself. Defining `FUNCPP_UNCHECKED` when building the
+ * modules and their importers removes these checks, and with them one
+ * classification instantiation for every constructed type.
+ */
+#ifdef FUNCPP_UNCHECKED
+#define FUNCPP_POSTCONDITION(...) static_assert(true)
+#else
+#define FUNCPP_POSTCONDITION(...) static_assert(__VA_ARGS__)
+#endif
+
+#endif // FUNCPP_CONFIG_H
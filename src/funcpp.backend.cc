@@ -0,0 +1,352 @@
+module;
+
+#include "funcpp-config.h"
+
+export module funcpp.backend;
+
+///@defgroup funcppBackend Constant evaluation backend for list algorithms
+
+export import funcpp.list;
+import funcpp.hash;
+
+namespace funcpp {
+
+  ///@addtogroup funcppBackend
+  ///@{
+
+  /// @internal
+  /// @brief Identifies `A` by its address
+  ///
+  /// Two addresses of `_id` compare equal in a constant expression
+  /// if and only if they are addresses of the same specialisation.
+  template<typename A>
+  constexpr char const _id = 0;
+
+  /// @internal
+  /// @brief The name of `A`, as spelled by the compiler
+  template<typename A>
+  consteval char const* _name() {
+    return __PRETTY_FUNCTION__;
+  }
+
+  /// @internal
+  /// @brief Hashes the name of `A`
+  ///
+  /// Equal types have equal hashes. Distinct types may share a hash,
+  /// for example if the compiler spells their names alike. Evaluated
+  /// once per type, not once per list.
+  template<typename A>
+  constexpr unsigned long long const _type_hash =
+    hash_string(_name<A>(), __builtin_strlen(_name<A>()));
+
+  /// @internal
+  /// @brief Positions selected from a list of length `N`
+  template<unsigned long long N>
+  struct _selection {
+    /// @brief Number of selected positions
+    unsigned long long size = 0;
+    /// @brief The selected positions, in order
+    unsigned long long at[N + 1] = {};
+  };
+
+  /// @internal
+  /// @brief Selects the positions `i` where `keep[i] == want`
+  template<unsigned long long N>
+  consteval _selection<N> _select(bool const* keep, bool want) {
+    _selection<N> s;
+    for (unsigned long long i = 0; i < N; ++i)
+      if (keep[i] == want) s.at[s.size++] = i;
+    return s;
+  }
+
+  /// @internal
+  /// @brief Orders the positions by `keys`, keeping equal keys in order
+  ///
+  /// Bottom-up merge sort.
+  template<unsigned long long N, typename K>
+  consteval _selection<N> _select_sorted(K const* keys) {
+    _selection<N> s;
+    s.size = N;
+    for (unsigned long long i = 0; i < N; ++i) s.at[i] = i;
+    unsigned long long* buffer = new unsigned long long[N + 1];
+    for (unsigned long long width = 1; width < N; width *= 2) {
+      for (unsigned long long lo = 0; lo < N; lo += 2 * width) {
+        unsigned long long const mid = lo + width < N ? lo + width : N;
+        unsigned long long const hi = lo + 2 * width < N ? lo + 2 * width : N;
+        unsigned long long i = lo, j = mid, k = lo;
+        while (i < mid and j < hi)
+          buffer[k++] = keys[s.at[j]] < keys[s.at[i]] ? s.at[j++] : s.at[i++];
+        while (i < mid) buffer[k++] = s.at[i++];
+        while (j < hi) buffer[k++] = s.at[j++];
+      }
+      for (unsigned long long i = 0; i < N; ++i) s.at[i] = buffer[i];
+    }
+    delete[] buffer;
+    return s;
+  }
+
+  /// @internal
+  /// @brief Selects the first occurrence of every id
+  ///
+  /// Equal ids have equal keys. Sorts the positions by key, and then
+  /// compares ids only within each run of equal keys, against the
+  /// distinct ids found so far in the run. So the cost is
+  /// `N log N` unless many distinct ids share a key.
+  template<unsigned long long N>
+  consteval _selection<N> _select_first(unsigned long long const* keys,
+                                        void const* const* ids) {
+    auto const sorted = _select_sorted<N>(keys);
+    bool keep[N + 1] = {};
+    unsigned long long* distinct = new unsigned long long[N + 1];
+    for (unsigned long long lo = 0, hi = 0; lo < N; lo = hi) {
+      unsigned long long found = 0;
+      for (hi = lo; hi < N and keys[sorted.at[hi]] == keys[sorted.at[lo]]; ++hi) {
+        void const* const id = ids[sorted.at[hi]];
+        bool first = true;
+        for (unsigned long long j = 0; first and j < found; ++j) first = ids[distinct[j]] != id;
+        if (first) distinct[found++] = sorted.at[hi];
+        keep[sorted.at[hi]] = first;
+      }
+    }
+    delete[] distinct;
+    return _select<N>(keep, true);
+  }
+
+  /// @internal
+  /// @brief Position of the first `id` in `ids`, or `N`
+  template<unsigned long long N>
+  consteval unsigned long long _find(void const* const* ids, void const* id) {
+    for (unsigned long long i = 0; i < N; ++i)
+      if (ids[i] == id) return i;
+    return N;
+  }
+
+  /// @internal
+  /// @brief Maps the positions selected by `S::selected` back to a list
+  template<typename S, typename Is, typename...As>
+  struct _gather;
+
+  /// @internal
+  template<typename S, unsigned long long...Is, typename...As>
+  struct _gather<S, index_sequence<Is...>, As...> {
+    using type = typename make_list<
+      typename pack_element<S::selected.at[Is], As...>::type...>::type;
+  };
+
+  /// @internal
+  template<typename S, typename...As>
+  using _gathered = typename _gather<
+    S, make_index_sequence<S::selected.size>, As...>::type;
+
+  /// @internal
+  template<typename A>
+  struct _index_of {
+    template<typename...As>
+    struct in {
+      static constexpr void const* ids[] = {&_id<As>..., nullptr};
+      using type = constant<unsigned long long,
+                            _find<sizeof...(As)>(ids, &_id<A>)>;
+    };
+  };
+
+  /// @internal
+  template<typename...As>
+  struct _unique_positions {
+    static constexpr unsigned long long keys[] = {_type_hash<As>..., 0};
+    static constexpr void const* ids[] = {&_id<As>..., nullptr};
+    static constexpr auto selected = _select_first<sizeof...(As)>(keys, ids);
+  };
+
+  /// @internal
+  template<typename...As>
+  struct _unique {
+    using type = _gathered<_unique_positions<As...>, As...>;
+  };
+
+  /// @internal
+  template<template<typename> typename P, bool want, typename...As>
+  struct _filter_positions {
+    static constexpr bool keep[] = {static_cast<bool>(P<As>::value)..., false};
+    static constexpr auto selected = _select<sizeof...(As)>(keep, want);
+  };
+
+  /// @internal
+  template<template<typename> typename P, bool want>
+  struct _filter {
+    template<typename...As>
+    struct in {
+      using type = _gathered<_filter_positions<P, want, As...>, As...>;
+    };
+  };
+
+  /// @internal
+  /// @brief `2` for floating point, `1` for signed, `0` for unsigned keys
+  template<typename A>
+  constexpr int const _key_rank = static_cast<A>(-1) < static_cast<A>(0) ? 1 : 0;
+
+  /// @internal
+  template<>
+  constexpr int const _key_rank<float> = 2;
+
+  /// @internal
+  template<>
+  constexpr int const _key_rank<double> = 2;
+
+  /// @internal
+  template<>
+  constexpr int const _key_rank<long double> = 2;
+
+  /// @internal
+  /// @brief A type that holds keys of every rank up to `rank`
+  template<int rank>
+  struct _key_type {
+    using type = unsigned long long;
+  };
+
+  /// @internal
+  template<>
+  struct _key_type<1> {
+    using type = long long;
+  };
+
+  /// @internal
+  template<>
+  struct _key_type<2> {
+    using type = long double;
+  };
+
+  /// @internal
+  consteval int _max_rank(int const* ranks, unsigned long long n) {
+    int r = 0;
+    for (unsigned long long i = 0; i < n; ++i) r = r < ranks[i] ? ranks[i] : r;
+    return r;
+  }
+
+  /// @internal
+  template<template<typename> typename K, typename...As>
+  struct _sort_positions {
+    static constexpr int ranks[] = {_key_rank<decltype(+K<As>::value)>..., 0};
+    using key = typename _key_type<_max_rank(ranks, sizeof...(As))>::type;
+    static constexpr key keys[] = {static_cast<key>(K<As>::value)..., 0};
+    static constexpr auto selected = _select_sorted<sizeof...(As)>(keys);
+  };
+
+  /// @internal
+  template<template<typename> typename K>
+  struct _sort {
+    template<typename...As>
+    struct in {
+      using type = _gathered<_sort_positions<K, As...>, As...>;
+    };
+  };
+
+  ///@}
+} // namespace funcpp
+
+/**
+ * @brief List algorithms evaluated as constant expressions
+ *
+ * Each algorithm converts a list into an array of type ids, runs an
+ * ordinary `consteval` loop over that array, and maps the result back
+ * to a list. Neither step recurses over the list, so the algorithms
+ * scale to lists of thousands of elements.
+ */
+export namespace funcpp::backend {
+
+  ///@addtogroup funcppBackend
+  ///@{
+
+  /**
+   * @brief Finds the position of a type in a list
+   *
+   * @tparam A any type
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is
+   * `constant<unsigned long long, i>` for the position `i` of the
+   * first occurrence of `A` in `L`, or for the length of `L` if `A`
+   * does not occur in `L`.
+   */
+  template<typename A, list_type L>
+  struct index_of {
+    /// @brief The position of `A` in `L`
+    using type = typename apply<_index_of<A>::template in, L>::type::type;
+  };
+
+  /**
+   * @brief Removes repeated types from a list
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is the list of the first occurrence
+   * of every type in `L`, in order.
+   */
+  template<list_type L>
+  struct unique {
+    /// @brief `L` without repetitions
+    using type = typename apply<_unique, L>::type::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Selects the elements of a list that satisfy a predicate
+   *
+   * @tparam P any unary type predicate with a member `value`
+   * convertible to `bool`
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is the list of all `A` in `L` for
+   * which `P<A>::value` is `true`, in order.
+   */
+  template<template<typename> typename P, list_type L>
+  struct filter {
+    /// @brief The elements of `L` that satisfy `P`
+    using type = typename apply<_filter<P, true>::template in, L>::type::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Splits a list by a predicate
+   *
+   * @tparam P any unary type predicate with a member `value`
+   * convertible to `bool`
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is a list of two lists: the
+   * elements of `L` that satisfy `P`, and those that do not, each in
+   * order.
+   */
+  template<template<typename> typename P, list_type L>
+  struct partition {
+    /// @brief The elements of `L` that satisfy `P`, and the others
+    using type = typename make_list<
+      typename apply<_filter<P, true>::template in, L>::type::type,
+      typename apply<_filter<P, false>::template in, L>::type::type>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Sorts a list by a key
+   *
+   * @tparam K any unary type transformer with a member `value` of
+   * arithmetic type
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is `L` sorted by ascending
+   * `K<A>::value`. Elements with equal keys keep their order.
+   */
+  template<template<typename> typename K, list_type L>
+  struct sort {
+    /// @brief `L` sorted by `K`
+    using type = typename apply<_sort<K>::template in, L>::type::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  ///@}
+} // namespace funcpp::backend
+
+// End of file
@@ -2,11 +2,21 @@
  * @brief Functional C++
  *
  * Putting the "fun" back into C++
+ *
+ * Umbrella module that re-exports all modules of the library. A
+ * translation unit that needs only part of the library should import
+ * that module directly, e.g. `import funcpp.list;`.
  */
 export module funcpp;
-export import :common;
-export import :list;
-export import :maybe;
+export import funcpp.common;
+export import funcpp.list;
+export import funcpp.maybe;
+export import funcpp.either;
+export import funcpp.hash;
+export import funcpp.backend;
+export import funcpp.layout;
+export import funcpp.set;
+export import funcpp.stream;
 
 /**
  * @brief Functional C++
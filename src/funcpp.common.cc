@@ -0,0 +1,398 @@
+export module funcpp.common;
+
+///@defgroup funcppCommon Concepts, types, and constants common to all modules
+
+export namespace funcpp
+{
+  ///@addtogroup funcppCommon
+  ///@{
+
+  /**
+   * @brief The constant value `a : A`.
+   *
+   * @tparam A any type
+   *
+   * @tparam a any value of type `A`
+   *
+   * Reproduces the template arguments `A` and `a` in the static
+   * members `value_type` and `value` respectively.
+   */
+  template<typename A, A a>
+  struct constant {
+    /// @brief Reproduces the template argument `A`
+    using value_type = A;
+    /// @brief Reproduces the template argument `a`
+    static constexpr value_type const value = a;
+  };
+
+  /**
+   * @brief The constant value `a : bool`.
+   *
+   * @tparam a any value of type `bool`
+   */
+  template<bool a>
+  struct bool_constant : constant<bool, a> {};
+
+  /**
+   * @brief The constant value `false : bool`.
+   *
+   * **Example:**
+   *
+   *     static_assert(not funcpp::false_type::value);
+   */
+  struct false_type : bool_constant<false> {};
+
+  /**
+   * @brief The constant value `true : bool`.
+   *
+   * **Example:**
+   *
+   *     static_assert(funcpp::true_type::value);
+   */
+  struct true_type : bool_constant<true> {};
+
+  /**
+   * @brief Checks if the type `A` is constant `0`.
+   *
+   * @tparam A any type
+   */
+  template<typename A>
+  struct is_zero : constant<bool, A::value == 0> {};
+
+  /**
+   * @brief The constant value `0 : A`.
+   *
+   * @tparam A any type
+   *
+   * **Example:**
+   *
+   *     static_assert(funcpp::zero::value == 0);
+   */
+  template<typename A>
+  struct zero_type : constant<A, 0> {};
+
+  /// @cond show_tmpl_spec
+  /**
+   * @brief Always true.
+   *
+   * Specialisation for `zero<A>`
+   */
+  template<typename A>
+  struct is_zero<zero_type<A>> : constant<bool, true> {};
+  /// @endcond
+
+  /**
+   * @brief The constant value `1 : A`.
+   *
+   * @tparam A any type
+   *
+   * **Example:**
+   *
+   *     static_assert(funcpp::one::value == 1);
+   */
+  template<typename A>
+  struct one_type : constant<A, 1> {};
+
+  /**
+   * @brief Checks it two types are the same.
+   *
+   * @tparam A any type
+   *
+   * @tparam B any type
+   *
+   * Binary type predicate that is `false` in general, but `true` when
+   * both arguments are the same type.
+   *
+   * **Example:**
+   *
+   *     static_assert(funcpp::refl<int, int>::value);
+   *     static_assert(not funcpp::refl<int, long>::value);
+   */
+  template<typename A, typename B>
+  struct refl;
+
+  /// @cond show_tmpl_spec
+  template<typename A, typename B>
+  struct refl : false_type {};
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A>
+  struct refl<A, A> : true_type {};
+  /// @endcond
+
+  /**
+   * @brief Maps a function `F` over a type `A`.
+   *
+   * @tparam F any unary type transformer
+   *
+   * @tparam A any type
+   *
+   * In general, this is just `F<A>::type`.
+   *
+   * May be specialised for certain types, for example collections.
+   */
+  template<template<typename> typename F, typename A>
+  struct map {
+    /// @brief `F` applied to `A`.
+    using type = typename F<A>::type;
+  };
+
+  /**
+   * @brief Reduces a type `A` given some function `F`.
+   *
+   * @tparam F any binary type transformer
+   *
+   * @tparam I any type
+   *
+   * @tparam A any type
+   *
+   * In general, this is just `F<I,A>::type`.
+   *
+   * May be specialised for certain types, for example collections.
+   */
+  template<template<typename, typename> typename F, typename I, typename A>
+  struct fold {
+    /// @brief `F` applied to `I` and `A`.
+    using type = typename F<I,A>::type;
+  };
+
+  /**
+   * @brief Counts a type `A`.
+   *
+   * @tparam A any type
+   *
+   * In general, this is undefined.
+   *
+   * May be specialised for certain types, for example collections.
+   *
+   * Specializations shall provide a static member `value : unsigned long long`.
+   */
+  template<typename A>
+  struct count;
+
+  /**
+   * @brief Removes one level of nesting from a nested type.
+   *
+   * @tparam A any type
+   *
+   * In general, this is undefined.
+   *
+   * May be specialised for certain types, for example collections.
+   */
+  template<typename>
+  struct join1;
+
+  /**
+   * @brief Inserts a type into a monad
+   *
+   * @tparam M tag type that names the monad, for example @ref list
+   * or @ref maybe
+   *
+   * @tparam A any type
+   *
+   * In general, this is undefined.
+   *
+   * Specialised by each monad for its tag type.
+   *
+   * **Example:**
+   *
+   *     using L = typename funcpp::pure<funcpp::list, int>::type;
+   *     using M = typename funcpp::pure<funcpp::maybe, int>::type;
+   */
+  template<typename M, typename A>
+  struct pure;
+
+  /**
+   * @brief Binds a monadic operation to a monad
+   *
+   * @tparam MA any monadic type
+   *
+   * @tparam F any type transformer from a type to a monadic type
+   *
+   * In general, this is undefined.
+   *
+   * May be specialised for certain types, for example collections.
+   */
+  template<typename MA, template<typename> typename F>
+  struct bind;
+
+  /**
+   * @brief Binds a sequence of monadic operations to a monad
+   *
+   * @tparam M any monadic type
+   *
+   * @tparam Fs any number of type transformers from a type to a
+   * monadic type
+   *
+   * Equivalent to nested @ref bind, i.e.
+   * `bind<bind<M, F1>::type, F2>::type`, and so forth.
+   *
+   * In general, this is undefined.
+   *
+   * Specialisations for monads with a failure case, for example
+   * optional types, stop at the first failure without instantiating
+   * any of the remaining steps.
+   */
+  template<typename M, template<typename> typename...Fs>
+  struct bind_chain;
+
+  /**
+   * @brief A sequence of constant values of type `A`
+   *
+   * @tparam A any integral type
+   *
+   * @tparam as any number of values of type `A`
+   */
+  template<typename A, A...as>
+  struct integer_sequence {
+    /// @brief Reproduces the template argument `A`
+    using value_type = A;
+    /// @brief The number of values
+    static constexpr unsigned long long const size = sizeof...(as);
+  };
+
+  /**
+   * @brief A sequence of indices
+   *
+   * @tparam Is any number of indices
+   */
+  template<unsigned long long...Is>
+  using index_sequence = integer_sequence<unsigned long long, Is...>;
+
+///@}
+} // namespace funcpp
+
+namespace funcpp
+{
+  ///@addtogroup funcppCommon
+  ///@{
+
+#if !__has_builtin(__make_integer_seq) && !__has_builtin(__integer_pack)
+  /// @internal
+  template<typename, typename>
+  struct _append_indices;
+
+  /// @internal
+  template<unsigned long long...Is, unsigned long long...Js>
+  struct _append_indices<index_sequence<Is...>, index_sequence<Js...>> {
+    /// @brief `Is` followed by `Js` shifted past `Is`
+    using type = index_sequence<Is..., (sizeof...(Is) + Js)...>;
+  };
+
+  /// @internal
+  /// @brief Halves `N` at every step, hence logarithmic depth
+  template<unsigned long long N>
+  struct _indices_upto : _append_indices<
+    typename _indices_upto<N / 2>::type,
+    typename _indices_upto<N - N / 2>::type> {};
+
+  /// @internal
+  template<>
+  struct _indices_upto<0> {
+    using type = index_sequence<>;
+  };
+
+  /// @internal
+  template<>
+  struct _indices_upto<1> {
+    using type = index_sequence<0>;
+  };
+#endif
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp
+{
+  ///@addtogroup funcppCommon
+  ///@{
+
+  /**
+   * @brief The sequence of indices `0`, …, `N-1`
+   *
+   * @tparam N number of indices
+   *
+   * Uses the integer sequence builtin of the compiler where
+   * available. Otherwise the instantiation depth is logarithmic in
+   * `N`.
+   */
+#if __has_builtin(__make_integer_seq)
+  template<unsigned long long N>
+  using make_index_sequence = __make_integer_seq<integer_sequence, unsigned long long, N>;
+#elif __has_builtin(__integer_pack)
+  template<unsigned long long N>
+  using make_index_sequence = index_sequence<__integer_pack(N)...>;
+#else
+  template<unsigned long long N>
+  using make_index_sequence = typename _indices_upto<N>::type;
+#endif
+
+///@}
+} // namespace funcpp
+
+namespace funcpp
+{
+  ///@addtogroup funcppCommon
+  ///@{
+
+#if !__has_builtin(__type_pack_element)
+  /// @internal
+  template<unsigned long long I, typename A>
+  struct _slot {
+    /// @brief Reproduces `A`
+    using type = A;
+  };
+
+  /// @internal
+  /// @brief Derives from `_slot<I, A>` for every `A` at position `I`
+  template<typename, typename...>
+  struct _slots;
+
+  /// @internal
+  template<unsigned long long...Is, typename...As>
+  struct _slots<index_sequence<Is...>, As...> : _slot<Is, As>... {};
+
+  /// @internal
+  /// @brief Deduces `A` from the only base `_slot<I, A>`
+  template<unsigned long long I, typename A>
+  auto _slot_at(_slot<I, A> const*) -> _slot<I, A>;
+#endif
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp
+{
+  ///@addtogroup funcppCommon
+  ///@{
+
+  /**
+   * @brief Selects an element of a parameter pack
+   *
+   * @tparam I any index less than `sizeof...(As)`
+   *
+   * @tparam As any number of types
+   *
+   * Provides a member `type` that is the element at position `I`
+   * of `As`.
+   *
+   * Uses the pack indexing builtin of the compiler where available.
+   * Otherwise the element is found by overload resolution. Neither
+   * recurses over `As`.
+   */
+  template<unsigned long long I, typename...As>
+  struct pack_element {
+#if __has_builtin(__type_pack_element)
+    /// @brief The element at position `I`
+    using type = __type_pack_element<I, As...>;
+#else
+    /// @brief The element at position `I`
+    using type = typename decltype(_slot_at<I>(
+      static_cast<_slots<make_index_sequence<sizeof...(As)>, As...> const*>(nullptr)))::type;
+#endif
+  };
+
+///@}
+} // namespace funcpp
+// End of file
@@ -0,0 +1,310 @@
+module;
+
+#include "funcpp-config.h"
+
+export module funcpp.either;
+
+///@defgroup funcppEither Values with an error alternative
+
+export import funcpp.common;
+
+namespace funcpp {
+
+  ///@addtogroup funcppEither
+  ///@{
+
+  /// @cond show_internal
+  /**
+   * @brief Alternative type that holds an error
+   *
+   * @tparam E any type
+   */
+  template <typename E>
+  struct _left {
+    /// @brief Reproduces `E`
+    using type = E;
+  };
+  /// @endcond
+
+  /// @cond show_internal
+  /**
+   * @brief Alternative type that holds a result
+   *
+   * @tparam A any type
+   */
+  template <typename A>
+  struct _right {
+    /// @brief Reproduces `A`
+    using type = A;
+  };
+  /// @endcond
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp {
+
+  ///@addtogroup funcppEither
+  ///@{
+
+  /**
+   * @brief Checks if a type is an alternative type.
+   *
+   * @tparam A any type
+   *
+   * If `A` is an alternative type, provides the member constant
+   * `value` equal to `true`.  In all other case, `value` is false.
+   */
+  template<typename A>
+  struct is_either : false_type {};
+
+  /// @cond show_tmpl_spec
+  template<typename E>
+  struct is_either<_left<E>> : true_type {};
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A>
+  struct is_either<_right<A>> : true_type {};
+  /// @endcond
+
+  /**
+   * @brief Specifies that a type is an alternative type
+   *
+   * @tparam A any type
+   *
+   * The concept `either_type<A>` is satisfied,
+   * - if `A` is `_left<E>` for any `E`, or
+   * - if `A` is `_right<B>` for any `B`.
+   */
+  template <typename A>
+  concept either_type = is_either<A>::value;
+
+  /**
+   * @brief Alternative type that holds an error
+   *
+   * @tparam E any type
+   *
+   * Provides a member `type` that holds the error `E`
+   */
+  template <typename E>
+  struct left {
+    /// @brief Holds `E`
+    using type = _left<E>;
+  };
+
+  /**
+   * @brief Alternative type that holds a result
+   *
+   * @tparam A any type
+   *
+   * Provides a member `type` that holds the result `A`
+   */
+  template <typename A>
+  struct right {
+    /// @brief Holds `A`
+    using type = _right<A>;
+  };
+
+  /**
+   * @brief Maps a function over an alternative type
+   *
+   * @tparam F any type transformer
+   *
+   * @tparam E any type
+   *
+   * Specialization of @ref map for an error.
+   *
+   * Provides a member `type` that reproduces the error.
+   */
+  template<template<typename> typename F, typename E>
+  struct map<F, _left<E>> {
+    /// The error `E`
+    using type = _left<E>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+
+  /**
+   * @brief Maps a function over an alternative type
+   *
+   * @tparam F any type transformer
+   *
+   * @tparam A any type
+   *
+   * Specialization of @ref map for a result.
+   *
+   * Provides a member `type` that holds `F` applied to the result.
+   */
+  template<template<typename> typename F, typename A>
+  struct map<F, _right<A>> {
+    /// The result `F<A>::type`
+    using type = _right<typename F<A>::type>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+
+  /**
+   * @brief Reduces an alternative type given some function `F`
+   *
+   * Provides a member `type` that reproduces `Acc`.
+   */
+  template<template<typename, typename> typename F, typename Acc, typename E>
+  struct fold<F, Acc, _left<E>> {
+    /// Reproduces the template argument `Acc`
+    using type = Acc;
+  };
+
+  /**
+   * @brief Reduces an alternative type given some function `F`
+   *
+   * Provides a member `type` that reproduces the result of the
+   * reduction.
+   *
+   * The relationship of `type` to `F`, `Acc`, `A` is as follows.
+   *
+   *     using type = typename F<Acc,A>::type;
+   */
+  template<template<typename, typename> typename F, typename Acc, typename A>
+  struct fold<F, Acc, _right<A>> {
+    /// @brief The result of reducing with `F` over `A`
+    using type = typename F<Acc, A>::type;
+  };
+
+  /**
+   * @brief Counts an alternative type
+   *
+   * @tparam A any alternative type
+   *
+   * Counts `0` for an error, `1` for a result.
+   */
+  template<either_type A>
+  struct count<A>;
+
+  /// @cond show_tmpl_spec
+  template<typename E>
+  struct count<_left<E>> : zero_type<unsigned long long> {};
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A>
+  struct count<_right<A>> : one_type<unsigned long long> {};
+  /// @endcond
+
+  /**
+   * @brief Flattens an alternative type holding an alternative type
+   *
+   * @tparam A any alternative type
+   *
+   * Removes one level of nesting from a result holding an
+   * alternative.
+   *
+   * For example, joining `right<right<A>>` will result in the
+   * flattened `right<A>`, and joining `right<left<E>>` will result
+   * in `left<E>`.
+   */
+  template<either_type A>
+  struct join1<A>;
+
+  /// @cond show_tmpl_spec
+  template<typename E>
+  struct join1<_left<E>> {
+    using type = _left<E>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename E>
+  struct join1<_right<_left<E>>> {
+    using type = _left<E>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A>
+  struct join1<_right<_right<A>>> {
+    using type = _right<A>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+  /// @endcond
+
+  /**
+   * @brief Names the alternative monad
+   *
+   * Tag type for @ref pure.
+   */
+  struct either {};
+
+  /**
+   * @brief Inserts a type into the alternative monad
+   *
+   * @tparam A any type
+   *
+   * Provides a member `type` that holds the result `A`.
+   */
+  template<typename A>
+  struct pure<either, A> {
+    /// `A` inserted into the monad
+    using type = typename right<A>::type;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+
+  /**
+   * @brief Binds monadic operation to a monad
+   */
+  template<either_type MA, template<typename> typename F>
+  struct bind<MA, F>;
+
+  /**
+   * @brief Binds monadic operation to a monad
+   */
+  template<typename E, template<typename> typename F>
+  struct bind<_left<E>, F> {
+    /// `F` bound to `_left<E>`
+    using type = _left<E>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+
+  /**
+   * @brief Binds monadic operation to a monad
+   */
+  template<typename A, template<typename> typename F>
+  struct bind<_right<A>, F> {
+    /// `F` bound to `_right<A>`
+    using type = typename F<A>::type;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+
+  /**
+   * @brief Binds a sequence of monadic operations to a monad
+   *
+   * Specialisation of @ref bind_chain for alternative types.
+   *
+   * Steps are bound one after the other, until either all steps are
+   * bound, or a step yields an error. The steps after that are not
+   * instantiated, and the error is the result of the chain.
+   */
+  template<either_type M>
+  struct bind_chain<M> {
+    /// Reproduces `M`
+    using type = M;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+
+  /// @cond show_tmpl_spec
+  template<typename E, template<typename> typename F, template<typename> typename...Fs>
+  struct bind_chain<_left<E>, F, Fs...> {
+    using type = _left<E>;
+    FUNCPP_POSTCONDITION(either_type<type>);
+  };
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A, template<typename> typename F, template<typename> typename...Fs>
+  struct bind_chain<_right<A>, F, Fs...> : bind_chain<typename F<A>::type, Fs...> {};
+  /// @endcond
+
+  ///@}
+} // namespace funcpp
+
+// End of file
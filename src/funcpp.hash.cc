@@ -0,0 +1,269 @@
+export module funcpp.hash;
+
+///@defgroup funcppHash Perfect hashing
+
+export import funcpp.list;
+
+export namespace funcpp {
+
+  ///@addtogroup funcppHash
+  ///@{
+
+  /**
+   * @brief Hashes a string
+   *
+   * @param s the first character of the string
+   *
+   * @param n the number of characters
+   *
+   * Computes the 64-bit FNV-1a hash of the string. Usable both at
+   * compile time and at run time.
+   *
+   * See https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+   */
+  constexpr unsigned long long hash_string(char const* s, unsigned long long n) noexcept {
+    unsigned long long h = 0xcbf29ce484222325ull;
+    for (unsigned long long i = 0; i < n; ++i) {
+      h ^= static_cast<unsigned char>(s[i]);
+      h *= 0x100000001b3ull;
+    }
+    return h;
+  }
+
+  /**
+   * @brief A string usable as a template argument
+   *
+   * @tparam N the size of the string literal, including its
+   * terminating null character
+   *
+   * **Example:**
+   *
+   *     using K = funcpp::string_key<"content-type">;
+   */
+  template<unsigned long long N>
+  struct fixed_string {
+    /// @brief The characters, including the terminating null character
+    char data[N] {};
+
+    /// @brief The number of characters, excluding the terminating null
+    static constexpr unsigned long long const length = N - 1;
+
+    /// @brief Copies a string literal
+    constexpr fixed_string(char const (&s)[N]) {
+      for (unsigned long long i = 0; i < N; ++i) data[i] = s[i];
+    }
+  };
+
+  /**
+   * @brief A key identified by a string
+   *
+   * @tparam s any fixed string
+   *
+   * The constant `value` is the @ref hash_string of `s`. The static
+   * member `text` reproduces `s`.
+   */
+  template<fixed_string s>
+  struct string_key : constant<unsigned long long, hash_string(s.data, s.length)> {
+    /// @brief Reproduces `s`
+    static constexpr auto const& text = s;
+  };
+
+  ///@}
+} // namespace funcpp
+
+namespace funcpp {
+
+  ///@addtogroup funcppHash
+  ///@{
+
+  /// @internal
+  /// @brief Parameters of the hash `(key * multiplier) >> shift`
+  struct _hash_parameters {
+    /// @brief Odd multiplier
+    unsigned long long multiplier;
+    /// @brief `64` minus the number of bits of a slot number
+    unsigned shift;
+    /// @brief Number of slots, `0` if no multiplier was found
+    unsigned long long size;
+  };
+
+  /// @internal
+  /// @brief One slot of the table
+  struct _hash_slot {
+    /// @brief The key that hashes to this slot
+    unsigned long long key;
+    /// @brief The position of `key` in the list of keys
+    unsigned long long index;
+  };
+
+  /// @internal
+  /// @brief Table of `Size` slots
+  template<unsigned long long Size>
+  struct _hash_table {
+    _hash_slot slots[Size];
+  };
+
+  /// @internal
+  /// @brief The output function of the splitmix64 generator
+  constexpr unsigned long long _mix(unsigned long long x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  /// @internal
+  consteval bool _distinct(unsigned long long const* keys, unsigned long long n) {
+    for (unsigned long long i = 0; i < n; ++i)
+      for (unsigned long long j = i + 1; j < n; ++j)
+        if (keys[i] == keys[j]) return false;
+    return true;
+  }
+
+  /// @internal
+  /// @brief Checks that no two keys hash to the same slot
+  consteval bool _injective(unsigned long long const* keys, unsigned long long n,
+                            _hash_parameters p) {
+    bool* used = new bool[p.size]{};
+    bool ok = true;
+    for (unsigned long long i = 0; ok and i < n; ++i) {
+      auto const slot = (keys[i] * p.multiplier) >> p.shift;
+      ok = not used[slot];
+      used[slot] = true;
+    }
+    delete[] used;
+    return ok;
+  }
+
+  /// @internal
+  /// @brief Searches for a collision-free multiplier
+  ///
+  /// Starts with at least twice as many slots as keys, and doubles
+  /// the number of slots after every 64 unsuccessful multipliers.
+  /// Gives up after 8 doublings and returns `size` equal to `0`. The
+  /// keys must be distinct, otherwise no multiplier can be found.
+  consteval _hash_parameters _find_hash(unsigned long long const* keys,
+                                        unsigned long long n) {
+    unsigned bits = 1;
+    while ((1ull << bits) < 2 * n) ++bits;
+    unsigned long long seed = 0;
+    for (unsigned const last = bits + 8; bits < last; ++bits) {
+      for (unsigned attempt = 0; attempt < 64; ++attempt) {
+        seed += 0x9e3779b97f4a7c15ull;
+        _hash_parameters const p{_mix(seed) | 1, 64 - bits, 1ull << bits};
+        if (_injective(keys, n, p)) return p;
+      }
+    }
+    return {0, 0, 0};
+  }
+
+  /// @internal
+  /// @brief Fills the table for the parameters found by `_find_hash`
+  ///
+  /// Empty slots hold the first key, which hashes to a different
+  /// slot. So no key can ever match an empty slot.
+  template<unsigned long long Size>
+  consteval _hash_table<Size> _fill_hash(unsigned long long const* keys,
+                                         unsigned long long n,
+                                         _hash_parameters p) {
+    _hash_table<Size> table{};
+    for (auto& slot : table.slots) slot = {n ? keys[0] : 0, n};
+    for (unsigned long long i = 0; i < n; ++i)
+      table.slots[(keys[i] * p.multiplier) >> p.shift] = {keys[i], i};
+    return table;
+  }
+
+  /// @internal
+  template<typename K>
+  concept _text_key = requires {
+    { K::text.data };
+    { K::text.length };
+  };
+
+  /// @internal
+  /// @brief The strings of the keys `Ks`
+  template<_text_key...Ks>
+  struct _key_texts {
+    static constexpr char const* data[sizeof...(Ks) + 1] = {Ks::text.data..., nullptr};
+    static constexpr unsigned long long lengths[sizeof...(Ks) + 1] = {Ks::text.length..., 0};
+  };
+
+  /// @internal
+  /// @brief Perfect hash over the keys `Ks`
+  template<typename...Ks>
+  struct _perfect_hash {
+    static constexpr unsigned long long size = sizeof...(Ks);
+
+    static constexpr unsigned long long miss = size;
+
+    static constexpr unsigned long long keys[size + 1] = {Ks::value..., 0};
+
+    static constexpr bool distinct = _distinct(keys, size);
+    static_assert(distinct, "keys must be distinct");
+
+    // With duplicate keys, skip the search, so that only the assertion
+    // above fails.
+    static constexpr _hash_parameters parameters =
+      distinct ? _find_hash(keys, size) : _hash_parameters{1, 63, 2};
+    static_assert(parameters.size != 0, "no collision-free multiplier found for the keys");
+
+    static constexpr _hash_table<parameters.size> table =
+      _fill_hash<parameters.size>(keys, size, parameters);
+
+    static constexpr unsigned long long find(unsigned long long key) noexcept {
+      auto const& slot = table.slots[(key * parameters.multiplier) >> parameters.shift];
+      return slot.key == key ? slot.index : miss;
+    }
+
+    static constexpr unsigned long long find(char const* s, unsigned long long n) noexcept
+      requires (_text_key<Ks> and ...)
+    {
+      using texts = _key_texts<Ks...>;
+      auto const i = find(hash_string(s, n));
+      if (i == miss or texts::lengths[i] != n) return miss;
+      return __builtin_memcmp(texts::data[i], s, n) == 0 ? i : miss;
+    }
+  };
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp {
+
+  ///@addtogroup funcppHash
+  ///@{
+
+  /**
+   * @brief Perfect hash over a list of keys
+   *
+   * @tparam L any list of keys
+   *
+   * Every key in `L` provides a static member `value` of integral
+   * type, for example a @ref constant or a @ref string_key. The
+   * values must be distinct.
+   *
+   * At compile time, searches for an odd multiplier `m` and a shift
+   * `s` such that `(key * m) >> s` maps all keys in `L` to distinct
+   * slots of a table.
+   *
+   * Provides
+   * - `size`, the number of keys,
+   * - `miss`, equal to `size`,
+   * - `find(key)`, the position of `key` in `L`, or `miss` if `key`
+   *   is not in `L`; costs one multiply, one shift, and one compare,
+   * - `find(s, n)`, if every key in `L` is a @ref string_key, the
+   *   position of the string of `n` characters at `s`, or `miss`.
+   *
+   * **Example:**
+   *
+   *     using H = funcpp::perfect_hash<typename funcpp::make_list<
+   *       funcpp::string_key<"accept">,
+   *       funcpp::string_key<"host">>::type>;
+   *     static_assert(H::find("host", 4) == 1);
+   */
+  template<list_type L>
+  struct perfect_hash : apply<_perfect_hash, L>::type {};
+
+  ///@}
+} // namespace funcpp
+
+// End of file
@@ -0,0 +1,241 @@
+module;
+
+#include "funcpp-config.h"
+
+export module funcpp.layout;
+
+///@defgroup funcppLayout Binary layouts of lists of fields
+
+export import funcpp.list;
+
+namespace funcpp {
+
+  ///@addtogroup funcppLayout
+  ///@{
+
+  /// @internal
+  template<typename A>
+  concept _field_type = __is_trivially_copyable(A);
+
+  /// @internal
+  /// @brief Scalar fields are subject to byte order conversion
+  ///
+  /// Excludes classes, unions, and arrays, whose bytes are copied as
+  /// they are.
+  template<typename A>
+  constexpr bool const _is_scalar =
+    not __is_class(A) and not __is_union(A) and requires (A& a) { a = a; };
+
+  /// @internal
+  inline constexpr bool const _big_endian = __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__;
+
+  /// @internal
+  /// @brief The bytes of an object of size `N`
+  template<unsigned long long N>
+  struct _bytes {
+    unsigned char at[N];
+  };
+
+  /// @internal
+  /// @brief Reverses the bytes of `a`
+  template<typename A>
+  constexpr A _byteswap(A a) noexcept {
+    auto b = __builtin_bit_cast(_bytes<sizeof(A)>, a);
+    for (unsigned long long i = 0; i < sizeof(A) / 2; ++i) {
+      auto const c = b.at[i];
+      b.at[i] = b.at[sizeof(A) - 1 - i];
+      b.at[sizeof(A) - 1 - i] = c;
+    }
+    return __builtin_bit_cast(A, b);
+  }
+
+  /// @internal
+  /// @brief Converts between host byte order and wire byte order
+  ///
+  /// The wire byte order is little endian, so this is the identity on
+  /// little endian hosts.
+  template<typename A>
+  constexpr A _wire_order(A a) noexcept {
+    if constexpr (_big_endian and _is_scalar<A>) return _byteswap(a);
+    else return a;
+  }
+
+  /// @internal
+  /// @brief Offsets of `N` fields, followed by the end of the last
+  template<unsigned long long N>
+  struct _offsets {
+    unsigned long long at[N + 1] = {};
+  };
+
+  /// @internal
+  /// @brief Places every field at the next multiple of its alignment
+  template<unsigned long long N>
+  consteval _offsets<N> _place(unsigned long long const* sizes,
+                               unsigned long long const* aligns) {
+    _offsets<N> o;
+    unsigned long long end = 0;
+    for (unsigned long long i = 0; i < N; ++i) {
+      o.at[i] = (end + aligns[i] - 1) / aligns[i] * aligns[i];
+      end = o.at[i] + sizes[i];
+    }
+    o.at[N] = end;
+    return o;
+  }
+
+  /// @internal
+  /// @brief Layout of the fields `As`
+  template<typename...As>
+  struct _layout {
+    static_assert((_field_type<As> and ...), "fields must be trivially copyable");
+
+    static constexpr unsigned long long const fields = sizeof...(As);
+
+    static constexpr unsigned long long const sizes[] = {sizeof(As)..., 0};
+    static constexpr unsigned long long const aligns[] = {alignof(As)..., 1};
+
+    static constexpr _offsets<fields> const offsets = _place<fields>(sizes, aligns);
+
+    static constexpr unsigned long long const alignment = [] {
+      unsigned long long a = 1;
+      for (auto b : aligns) a = a < b ? b : a;
+      return a;
+    }();
+
+    static constexpr unsigned long long const size =
+      (offsets.at[fields] + alignment - 1) / alignment * alignment;
+
+    template<unsigned long long I>
+    using field = typename pack_element<I, As...>::type;
+
+    template<unsigned long long I>
+    static constexpr unsigned long long const offset = offsets.at[I];
+  };
+
+  /// @internal
+  /// @brief Stores `as` at their offsets, and zeroes the padding
+  template<typename Is, typename...As>
+  struct _serialize;
+
+  /// @internal
+  template<unsigned long long...Is, typename...As>
+  struct _serialize<index_sequence<Is...>, As...> : _layout<As...> {
+    using _layout<As...>::offsets;
+    using _layout<As...>::sizes;
+    using _layout<As...>::size;
+
+    static void write(unsigned char* out, As const&...as) noexcept {
+      (_write<Is>(out, _wire_order(as)), ...);
+      auto const end = offsets.at[sizeof...(As)];
+      __builtin_memset(out + end, 0, size - end);
+    }
+
+    template<unsigned long long I, typename A>
+    static void _write(unsigned char* out, A const& a) noexcept {
+      constexpr auto const begin = I == 0 ? 0 : offsets.at[I - 1] + sizes[I - 1];
+      __builtin_memset(out + begin, 0, offsets.at[I] - begin);
+      __builtin_memcpy(out + offsets.at[I], &a, sizeof(A));
+    }
+  };
+
+  /// @internal
+  template<typename...As>
+  using _serialize_fields = _serialize<make_index_sequence<sizeof...(As)>, As...>;
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp {
+
+  ///@addtogroup funcppLayout
+  ///@{
+
+  /**
+   * @brief Wire layout of a list of fields
+   *
+   * @tparam L any list of trivially copyable types
+   *
+   * Places every field of `L` at the next multiple of its alignment,
+   * in order, like the members of a structure. The wire byte order of
+   * scalar fields is little endian. Fields of class, union, or array
+   * type are copied as they are.
+   *
+   * Provides
+   * - `fields`, the number of fields,
+   * - `alignment`, the largest alignment of any field,
+   * - `size`, the number of bytes of a message, a multiple of
+   *   `alignment`,
+   * - `field<I>`, the type of field `I`,
+   * - `offset<I>`, the position of field `I` in a message.
+   *
+   * **Example:**
+   *
+   *     using M = funcpp::layout<typename funcpp::make_list<char, int>::type>;
+   *     static_assert(M::offset<1> == 4 and M::size == 8);
+   */
+  template<list_type L>
+  struct layout : apply<_layout, L>::type {};
+
+  /**
+   * @brief Read-only view of a message in a buffer
+   *
+   * @tparam L any list of trivially copyable types
+   *
+   * Reads the fields of a message in the @ref layout of `L` straight
+   * from the buffer, without decoding the message first. The buffer
+   * needs no particular alignment.
+   *
+   * **Example:**
+   *
+   *     using V = funcpp::view<typename funcpp::make_list<char, int>::type>;
+   *     int n = V{buffer}.get<1>();
+   */
+  template<list_type L>
+  struct view {
+    /// @brief The layout of the message
+    using layout_type = layout<L>;
+
+    /// @brief The first byte of the message
+    unsigned char const* data;
+
+    /// @brief Reads field `I`
+    template<unsigned long long I>
+    typename layout_type::template field<I> get() const noexcept {
+      using A = typename layout_type::template field<I>;
+      _bytes<sizeof(A)> b;
+      __builtin_memcpy(b.at, data + layout_type::template offset<I>, sizeof(A));
+      return _wire_order(__builtin_bit_cast(A, b));
+    }
+  };
+
+  /**
+   * @brief Writes messages in the layout of a list of fields
+   *
+   * @tparam L any list of trivially copyable types
+   *
+   * Provides the members of @ref layout<L>, and
+   * - `write(out, as...)`, which writes the fields `as...` to the
+   *   @ref layout<L>::size bytes at `out`, and zeroes the padding,
+   * - `copy(out, v)`, which copies the message viewed by `v` to
+   *   `out` in a single `memcpy`.
+   *
+   * Every field is written with a `memcpy` of constant size to a
+   * constant offset, which compilers merge into wider stores.
+   *
+   * **Example:**
+   *
+   *     using S = funcpp::serialize<typename funcpp::make_list<char, int>::type>;
+   *     unsigned char buffer[S::size];
+   *     S::write(buffer, 'x', 42);
+   */
+  template<list_type L>
+  struct serialize : apply<_serialize_fields, L>::type {
+    /// @brief Copies the message viewed by `v` to `out`
+    static void copy(unsigned char* out, view<L> v) noexcept {
+      __builtin_memcpy(out, v.data, serialize::size);
+    }
+  };
+
+  ///@}
+} // namespace funcpp
+
+// End of file
@@ -0,0 +1,914 @@
+module;
+
+#include "funcpp-config.h"
+
+export module funcpp.list;
+
+///@defgroup funcppList Lists
+
+export import funcpp.common;
+
+namespace funcpp {
+
+  ///@addtogroup funcppList
+  ///@{
+
+  /**
+   * @brief Primitive for a unit type.
+   *
+   * A @ref _nil represents tautological information. It doesn't
+   * represent the absence of information, but rather it's telling you
+   * nothing that you don't already know.
+   */
+  struct _nil {};
+
+  /// @internal
+  /// @brief Checks if a type is `_nil` or `_cons`, without recursion
+  template<typename>
+  struct _is_node : false_type {};
+
+  /// @internal
+  template<>
+  struct _is_node<_nil> : true_type {};
+
+  /// @internal
+  template <typename A, typename B> requires _is_node<B>::value
+  struct _cons;
+
+  /// @internal
+  template<typename A, typename B>
+  struct _is_node<_cons<A,B>> : true_type {};
+
+  /**
+   * @brief Primitive for a pair type
+   *
+   * @tparam A any type
+   *
+   * @tparam B `_nil` or any `_cons`
+   *
+   * A @ref _cons binds together two objects (types). The name _cons_
+   * derives from _to construct_.
+   *
+   * The constraint on `B` looks only at the outermost node of `B`.
+   * Since every `_cons` is checked when it is formed, a `_cons` is
+   * always a well-formed list, by induction over its length.
+   *
+   * See https://en.wikipedia.org/wiki/Cons
+   */
+  template <typename A, typename B> requires _is_node<B>::value
+  struct _cons {
+    /**
+     * @brief The first element of the `_cons`
+     *
+     * Traditionally called _car_ because it used to be the _contents_
+     * of the _address_ part of some _register_ on the IBM 704.
+     *
+     * See https://en.wikipedia.org/wiki/CAR_and_CDR
+     */
+    using car = A;
+    /**
+     * @brief The second element of the `_cons`
+     *
+     * Traditionally called _cdr_ because it used to be the _contents_
+     * of the _decrement_ part of some _register_ on the IBM 704.
+     *
+     * See https://en.wikipedia.org/wiki/CAR_and_CDR
+     */
+    using cdr = B;
+  };
+
+  /// @internal
+  template<typename A>
+  struct _head {};
+
+  /// @internal
+  template<typename L>
+  struct _tail {
+    /// @brief Reproduces `L`
+    using type = L;
+  };
+
+  /// @internal
+  /// @brief Prepends `A` to `L`
+  template<typename A, typename L>
+  auto operator+(_head<A>, _tail<L>) -> _tail<_cons<A, L>>;
+
+  /// @internal
+  /// @brief Largest number of operands of a single fold expression
+  ///
+  /// Clang rejects fold expressions with more operands than its
+  /// bracket depth, which is 256 by default. Other compilers have no
+  /// such limit.
+#ifdef __clang__
+  inline constexpr unsigned long long const _fold_limit = 128;
+#else
+  inline constexpr unsigned long long const _fold_limit = -1;
+#endif
+
+  /// @internal
+  template<typename...Os>
+  struct _operands {};
+
+  /// @internal
+  /// @brief The operands `Begin + I` of `P`, for every `I` in `Is`
+  template<typename P, unsigned long long Begin, typename Is>
+  struct _block {};
+
+  /// @internal
+  /// @brief Prepends the operands `Os` to the list `L`
+  ///
+  /// Every operand is a `_head<A>`, which contributes `A`. A single
+  /// right fold expression prepends up to `_fold_limit` operands. More
+  /// operands are split into at most `_fold_limit` blocks, which are
+  /// prepended by a fold expression in turn. So the instantiation depth
+  /// grows with the logarithm of the number of operands to base
+  /// `_fold_limit`.
+  template<typename L, typename...Os>
+  struct _prepend;
+
+  /// @internal
+  /// @brief Prepends the operands of a block to `L`
+  template<typename...Os, unsigned long long Begin, unsigned long long...Is, typename L>
+  auto operator+(_block<_operands<Os...>, Begin, index_sequence<Is...>>, _tail<L>)
+    -> _tail<typename _prepend<L, typename pack_element<Begin + Is, Os...>::type...>::type>;
+
+  /// @internal
+  template<bool small, typename L, typename...Os>
+  struct _prepend_operands {
+    using type = typename decltype((Os{} + ... + _tail<L>{}))::type;
+  };
+
+  /// @internal
+  template<typename L, typename P, unsigned long long S, unsigned long long N, typename Ks>
+  struct _prepend_blocks;
+
+  /// @internal
+  template<typename L, typename P, unsigned long long S, unsigned long long N,
+           unsigned long long...Ks>
+  struct _prepend_blocks<L, P, S, N, index_sequence<Ks...>> {
+    using type = typename decltype((
+      _block<P, Ks * S, make_index_sequence<(N - Ks * S < S ? N - Ks * S : S)>>{} + ... +
+      _tail<L>{}))::type;
+  };
+
+  /// @internal
+  template<typename L, typename...Os>
+  struct _prepend_operands<false, L, Os...> {
+    static constexpr unsigned long long const size = sizeof...(Os);
+    /// @brief Block size, such that there are at most `_fold_limit` blocks
+    static constexpr unsigned long long const block = (size + _fold_limit - 1) / _fold_limit;
+    using type = typename _prepend_blocks<
+      L, _operands<Os...>, block, size,
+      make_index_sequence<(size + block - 1) / block>>::type;
+  };
+
+  /// @internal
+  template<typename L, typename...Os>
+  struct _prepend : _prepend_operands<(sizeof...(Os) <= _fold_limit), L, Os...> {};
+
+  /// @internal
+  /// @brief Builds `_cons<A0, _cons<A1, … _nil>>` from a parameter pack
+  ///
+  /// Uses fold expressions instead of recursion, so the instantiation
+  /// depth grows only with the logarithm of the number of elements.
+  template<typename...As>
+  using _list_of = typename _prepend<_nil, _head<As>...>::type;
+
+  /// @internal
+  /// @brief Ignores `I`, reproduces `A`
+  template<typename A, unsigned long long I>
+  using _always = A;
+
+  /// @internal
+  template<typename>
+  struct _range;
+
+  /// @internal
+  template<unsigned long long...Is>
+  struct _range<index_sequence<Is...>> {
+    using type = _list_of<constant<unsigned long long, Is>...>;
+  };
+
+  /// @internal
+  template<typename, typename>
+  struct _repeat;
+
+  /// @internal
+  template<typename A, unsigned long long...Is>
+  struct _repeat<A, index_sequence<Is...>> {
+    using type = _list_of<_always<A, Is>...>;
+  };
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp
+{
+  ///@addtogroup funcppList
+  ///@{
+
+  /**
+   * @brief Checks if a type is a list
+   *
+   * @tparam A any type
+   *
+   * If `A` is a list, provides the member constant `value` equal to
+   * `true`.  In all other case, `value` is false.
+   *
+   * Classification costs a single instantiation, regardless of the
+   * length of the list, because `_cons` guarantees that its tail is a
+   * list.
+   */
+  template<typename A>
+  struct is_list : false_type {};
+
+  /// @cond show_tmpl_spec
+  template<>
+  struct is_list<_nil> : true_type {};
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A, typename B>
+  struct is_list<_cons<A,B>> : true_type {};
+  /// @endcond
+
+  /**
+   * @brief Specifies that a type is a list
+   *
+   * @tparam A any type
+   *
+   * The concept `list_type<A>` is satisfied,
+   * - if `A` is `_nil`, or
+   * - if `A` is `_cons<B,C>` and `C` is a list.
+   */
+  template <typename A>
+  concept list_type = is_list<A>::value;
+
+  /**
+   * @brief Constructs an empty list
+   *
+   * Provides a member `type` that is an empty list.
+   */
+  struct nil {
+    /// @brief An empty list
+    using type = _nil;
+  };
+
+  /**
+   * @brief Constructs a new list
+   *
+   * @tparam A any type
+   *
+   * @tparam B any list type
+   *
+   * Constructs a new list that comprises `A` followed by `B`.
+   *
+   * Provides a member `type` that holds the new list.
+   */
+  template<typename A, list_type B>
+  struct cons {
+    /// @brief The new list
+    using type = _cons<A,B>;
+  };
+
+  /**
+   * @brief Constructs a list from a parameter pack
+   *
+   * @tparam As any number of types
+   *
+   * **Example:**
+   *
+   *     using L = typename funcpp::make_list<char, short, int, long>::type;
+   *
+   * The instantiation depth does not depend on the number of types.
+   */
+  template<typename...As>
+  struct make_list {
+    /// @brief The list of `As`
+    using type = _list_of<As...>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Constructs the list of the first `N` natural numbers
+   *
+   * @tparam N number of elements
+   *
+   * Provides a member `type` that is the list
+   * `constant<unsigned long long, 0>`, …,
+   * `constant<unsigned long long, N-1>`.
+   *
+   * Uses the integer sequence builtin of the compiler where
+   * available. Otherwise the instantiation depth is logarithmic in
+   * `N`.
+   *
+   * **Example:**
+   *
+   *     using L = typename funcpp::range<3>::type;
+   *     // L is <constant<unsigned long long, 0>,
+   *     //       constant<unsigned long long, 1>,
+   *     //       constant<unsigned long long, 2>>
+   */
+  template<unsigned long long N>
+  struct range {
+    /// @brief The list `0`, …, `N-1`
+    using type = typename _range<make_index_sequence<N>>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Constructs a list that repeats a type
+   *
+   * @tparam N number of elements
+   *
+   * @tparam A any type
+   *
+   * Provides a member `type` that is the list of `N` times `A`.
+   *
+   * Uses the integer sequence builtin of the compiler where
+   * available. Otherwise the instantiation depth is logarithmic in
+   * `N`.
+   *
+   * **Example:**
+   *
+   *     using L = typename funcpp::repeat<3, int>::type;
+   *     // L is <int, int, int>
+   */
+  template<unsigned long long N, typename A>
+  struct repeat {
+    /// @brief The list of `N` times `A`
+    using type = typename _repeat<A, make_index_sequence<N>>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Maps a function over an empty list
+   *
+   * @tparam F any type transformer
+   *
+   * Specialization of @ref map for empty lists.
+   *
+   * Provides a member `type` that is an empty list.
+   */
+  template<template<typename> typename F>
+  struct map<F, _nil> {
+    /// An empty list
+    using type = _nil;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Maps a function over a non-empty list
+   *
+   * @tparam F any type transformer
+   *
+   * @tparam A any type
+   *
+   * @tparam B any list type
+   *
+   * Specialization of @ref map for non-empty lists.
+   *
+   * Provides a member `type` that is a non-empty list.
+   *
+   * The relationship of `type` to `F`, `A`, `B` is as follows.
+   *
+   *     using head = typename F<A>::type;
+   *     using tail = typename map<F, B>::type;
+   *     using type = _cons<head, tail>;
+   *
+   * where `head` and `tail` are introduced here for documentation
+   * purposes. They are not members of @ref map<F,_cons<A,B>>.
+   */
+  template<template<typename> typename F, typename A, list_type B>
+  struct map<F, _cons<A, B>> {
+    /// A non-empty list
+    using type = _cons<typename F<A>::type, typename map<F, B>::type>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Reduces an empty list given some function `F`
+   *
+   * Provides a member `type` that reproduces `Acc`.
+   */
+  template<template<typename, typename> typename F, typename Acc>
+  struct fold<F, Acc, _nil> {
+    /// Reproduces the template argument `Acc`
+    using type = Acc;
+  };
+
+  /**
+   * @brief Reduces a non-empty list given some function `F`
+   *
+   * Provides a member `type` that reproduces the result of the
+   * reduction.
+   *
+   * The relationship of `type` to `F`, `Acc`, `A`, `B` is as follows.
+   *
+   *     using acc_ = typename F<Acc,A>::type;
+   *     using type = typename fold<F, acc2, B>::type
+   *
+   * where `acc_` is introduced here for documentation purposes. It is
+   * not a member of @ref fold<F,Acc,_cons<A,B>>.
+   */
+  template<template<typename, typename> typename F, typename Acc, typename A, list_type B>
+  struct fold<F, Acc, _cons<A, B>> {
+    /// @brief The result of reducing with `F` over `A`
+    using type = typename fold<F, typename F<Acc, A>::type, B>::type;
+  };
+
+  ///@}
+} // namespace funcpp
+
+namespace funcpp {
+  ///@addtogroup funcppList
+  ///@{
+
+  /// @internal
+  template<typename A, typename>
+  struct _plus1 {
+    /// @brief `1` added to `A`
+    using type = constant<typename A::value_type, 1 + A::value>;
+  };
+
+  /// @internal
+  /// @brief Moves the elements of `L` behind `As`, then applies `T`
+  ///
+  /// Takes 16 elements per step where possible, so the instantiation
+  /// depth is the length of `L` divided by 16.
+  template<template<typename...> typename T, typename L, typename...As>
+  struct _unpack;
+
+  /// @internal
+  template<template<typename...> typename T, typename...As>
+  struct _unpack<T, _nil, As...> {
+    using type = T<As...>;
+  };
+
+  /// @internal
+  template<template<typename...> typename T, typename A, typename L, typename...As>
+  struct _unpack<T, _cons<A, L>, As...> : _unpack<T, L, As..., A> {};
+
+  /// @internal
+  template<template<typename...> typename T,
+           typename A0, typename A1, typename A2, typename A3,
+           typename A4, typename A5, typename A6, typename A7,
+           typename A8, typename A9, typename A10, typename A11,
+           typename A12, typename A13, typename A14, typename A15,
+           typename L, typename...As>
+  struct _unpack<T,
+                 _cons<A0, _cons<A1, _cons<A2, _cons<A3,
+                 _cons<A4, _cons<A5, _cons<A6, _cons<A7,
+                 _cons<A8, _cons<A9, _cons<A10, _cons<A11,
+                 _cons<A12, _cons<A13, _cons<A14, _cons<A15,
+                 L>>>>>>>>>>>>>>>>,
+                 As...>
+    : _unpack<T, L, As...,
+              A0, A1, A2, A3, A4, A5, A6, A7,
+              A8, A9, A10, A11, A12, A13, A14, A15> {};
+
+  ///@}
+}
+
+export namespace funcpp
+{
+  ///@addtogroup funcppList
+  ///@{
+  /**
+   * @brief Counts the elements of a list
+   *
+   * @tparam A any list type
+   */
+  template<list_type A>
+  struct count<A> {
+    /// @brief Number of elements in `A`
+    static constexpr auto const value =
+      fold<_plus1, zero_type<unsigned long long>, A>::type::value;
+  };
+
+  /**
+   * @brief Applies a variadic template to the elements of a list
+   *
+   * @tparam T any variadic template
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is `T<A0, A1, …>` for the elements
+   * `A0`, `A1`, … of `L`.
+   *
+   * This converts a list into a parameter pack. The instantiation
+   * depth grows with the length of `L` divided by 16.
+   *
+   * **Example:**
+   *
+   *     template<typename...As> struct size { … };
+   *     using S = typename funcpp::apply<size, L>::type;
+   */
+  template<template<typename...> typename T, list_type L>
+  struct apply {
+    /// @brief `T` applied to the elements of `L`
+    using type = typename _unpack<T, L>::type;
+  };
+
+  /**
+   * @brief Flattens a list of list
+   *
+   * @tparam A any list type
+   *
+   * Removes one level of nesting from a list of lists.
+   *
+   * For example, joining the list `<<A,B>,<C,D>>` will result in the
+   * flattened list `<A,B,C,D>`.
+   */
+  template<list_type A>
+  struct join1<A>;
+
+  /// @cond show_tmpl_spec
+  template<>
+  struct join1<_nil> {
+    using type = _nil;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<list_type B>
+  struct join1<_cons<_nil, B>> {
+    using type = typename join1<B>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A, list_type B, list_type C>
+  struct join1<_cons<_cons<A, B>, C>> {
+    using type = _cons<A, typename join1<_cons<B, C>>::type>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+  /// @endcond
+
+  /**
+   * @brief Names the list monad
+   *
+   * Tag type for @ref pure.
+   */
+  struct list {};
+
+  /**
+   * @brief Inserts a type into the list monad
+   *
+   * @tparam A any type
+   *
+   * Provides a member `type` that is the list of just `A`.
+   */
+  template<typename A>
+  struct pure<list, A> {
+    /// `A` inserted into the monad
+    using type = typename cons<A, _nil>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Binds monadic operation to a monad
+   */
+  template<list_type MA, template<typename> typename F>
+  struct bind<MA, F> {
+    /// `F` bound to `MA`
+    using type = typename join1<typename map<F, MA>::type>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+  ///@}
+} // namespace funcpp
+
+namespace funcpp {
+  ///@addtogroup funcppList
+  ///@{
+
+  /// @internal
+  /// @brief Holds the elements of a list as a parameter pack
+  template<typename...As>
+  struct _pack {
+    /// @brief Number of elements
+    static constexpr unsigned long long const size = sizeof...(As);
+    /// @brief The element at position `I`
+    template<unsigned long long I>
+    using element = typename pack_element<I, As...>::type;
+  };
+
+  /// @internal
+  /// @brief Combinations of the elements of the packs `Ps`
+  ///
+  /// Combination `K` takes from pack `J` the element at digit `J` of
+  /// `K`, written in the mixed radix of the pack sizes. The last pack
+  /// varies fastest.
+  template<typename Js, typename...Ps>
+  struct _product;
+
+  /// @internal
+  template<unsigned long long...Js, typename...Ps>
+  struct _product<index_sequence<Js...>, Ps...> {
+    static constexpr unsigned long long const sizes[] = {Ps::size..., 1};
+
+    /// @brief Digit `j` of `k`
+    static consteval unsigned long long digit(unsigned long long k, unsigned long long j) {
+      for (unsigned long long i = sizeof...(Ps); i > j + 1; --i) k /= sizes[i - 1];
+      return k % sizes[j];
+    }
+
+    /// @brief Combination `K`
+    template<unsigned long long K>
+    using tuple = _list_of<typename Ps::template element<digit(K, Js)>...>;
+
+    template<typename Ks>
+    struct tuples;
+
+    template<unsigned long long...Ks>
+    struct tuples<index_sequence<Ks...>> {
+      using type = _list_of<tuple<Ks>...>;
+    };
+
+    using type = typename tuples<make_index_sequence<(Ps::size * ... * 1)>>::type;
+  };
+
+  /// @internal
+  constexpr unsigned long long _min(unsigned long long a, unsigned long long b) {
+    return a < b ? a : b;
+  }
+
+  /// @internal
+  /// @brief The elements `Begin + I` of the pack `P`, for every `I` in `Is`
+  template<typename P, unsigned long long Begin, typename Is>
+  struct _slice;
+
+  /// @internal
+  template<typename P, unsigned long long Begin, unsigned long long...Is>
+  struct _slice<P, Begin, index_sequence<Is...>> {
+    using type = _list_of<typename P::template element<Begin + Is>...>;
+  };
+
+  /// @internal
+  /// @brief The elements `Begin`, …, `End - 1` of the pack `P`
+  template<typename P, unsigned long long Begin, unsigned long long End>
+  using _sliced = typename _slice<P, Begin, make_index_sequence<End - Begin>>::type;
+
+  /// @internal
+  /// @brief Pairs the first `sizeof...(Is)` elements of the packs `P` and `Q`
+  template<typename P, typename Q, typename Is>
+  struct _zip;
+
+  /// @internal
+  template<typename P, typename Q, unsigned long long...Is>
+  struct _zip<P, Q, index_sequence<Is...>> {
+    using type = _list_of<_list_of<typename P::template element<Is>,
+                                   typename Q::template element<Is>>...>;
+  };
+
+  /// @internal
+  /// @brief Contributes nothing to a list built like `_list_of`
+  struct _skip {};
+
+  /// @internal
+  /// @brief Leaves `L` as it is
+  template<typename L>
+  auto operator+(_skip, _tail<L>) -> _tail<L>;
+
+  /// @internal
+  /// @brief `_head<A>` if `keep`, otherwise `_skip`
+  template<bool keep, typename A>
+  struct _head_if {
+    using type = _head<A>;
+  };
+
+  /// @internal
+  template<typename A>
+  struct _head_if<false, A> {
+    using type = _skip;
+  };
+
+  /// @internal
+  /// @brief The elements `A` of `As` for which `P<A>::value == want`
+  ///
+  /// Maps every element to either one or no element, and builds the
+  /// list in a single fold expression, like `_list_of`.
+  template<template<typename> typename P, bool want, typename...As>
+  using _filtered = typename decltype((
+    typename _head_if<static_cast<bool>(P<As>::value) == want, As>::type{} + ... +
+    _tail<_nil>{}))::type;
+
+  /// @internal
+  template<template<typename> typename P>
+  struct _keep_if {
+    template<typename...As>
+    struct in {
+      using type = _filtered<P, true, As...>;
+      using rest = _filtered<P, false, As...>;
+    };
+  };
+
+  /// @internal
+  /// @brief Splits the pairs in the pack `P`
+  template<typename P, typename Is>
+  struct _unzip;
+
+  /// @internal
+  template<typename P, unsigned long long...Is>
+  struct _unzip<P, index_sequence<Is...>> {
+    using type = _list_of<
+      _list_of<typename P::template element<Is>::car...>,
+      _list_of<typename P::template element<Is>::cdr::car...>>;
+  };
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp
+{
+  ///@addtogroup funcppList
+  ///@{
+
+  /**
+   * @brief Constructs the cartesian product of lists
+   *
+   * @tparam Ls any number of list types
+   *
+   * Provides a member `type` that is the list of all combinations
+   * that take one element from each of `Ls`, in order. Each
+   * combination is a list with one element per list in `Ls`. The last
+   * list varies fastest, so the result is the same as that of nested
+   * @ref bind over `Ls`.
+   *
+   * Every combination is built directly from its position in the
+   * result, without intermediate lists.
+   *
+   * **Example:**
+   *
+   *     using L = typename funcpp::product<
+   *       funcpp::make_list<char, int>::type,
+   *       funcpp::make_list<float, double>::type>::type;
+   *     // L is <<char, float>, <char, double>,
+   *     //       <int, float>, <int, double>>
+   */
+  template<list_type...Ls>
+  struct product {
+    /// @brief The combinations of the elements of `Ls`
+    using type = typename _product<
+      make_index_sequence<sizeof...(Ls)>,
+      typename apply<_pack, Ls>::type...>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Takes the first elements of a list
+   *
+   * @tparam N number of elements
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is the list of the first `N`
+   * elements of `L`, or `L` if it has fewer than `N` elements.
+   *
+   * Like @ref apply, the instantiation depth grows with the length of
+   * `L` divided by 16. It does not depend on `N`.
+   */
+  template<unsigned long long N, list_type L>
+  struct take {
+    /// @brief The first `N` elements of `L`
+    using type = _sliced<typename apply<_pack, L>::type, 0,
+                         _min(N, apply<_pack, L>::type::size)>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Drops the first elements of a list
+   *
+   * @tparam N number of elements
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is the list of the elements of `L`
+   * after the first `N`, or an empty list if `L` has fewer than `N`
+   * elements.
+   *
+   * Like @ref apply, the instantiation depth grows with the length of
+   * `L` divided by 16. It does not depend on `N`.
+   */
+  template<unsigned long long N, list_type L>
+  struct drop {
+    /// @brief The elements of `L` after the first `N`
+    using type = _sliced<typename apply<_pack, L>::type,
+                         _min(N, apply<_pack, L>::type::size),
+                         apply<_pack, L>::type::size>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Splits a list at a position
+   *
+   * @tparam N number of elements
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is a list of two lists:
+   * `take<N, L>::type` and `drop<N, L>::type`. `L` is unpacked only
+   * once for both.
+   *
+   * **Example:**
+   *
+   *     using L = typename funcpp::split_at<1, typename funcpp::make_list<char, int, long>::type>::type;
+   *     // L is <<char>, <int, long>>
+   */
+  template<unsigned long long N, list_type L>
+  struct split_at {
+    /// @brief The first `N` elements of `L`, and the others
+    using type = _list_of<
+      typename take<N, L>::type,
+      typename drop<N, L>::type>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Pairs the elements of two lists
+   *
+   * @tparam L1 any list type
+   *
+   * @tparam L2 any list type
+   *
+   * Provides a member `type` that is the list of the lists `<A, B>`
+   * of the elements `A` of `L1` and `B` of `L2` at the same position.
+   * The result is as long as the shorter of `L1` and `L2`.
+   */
+  template<list_type L1, list_type L2>
+  struct zip {
+    /// @brief The pairs of elements of `L1` and `L2`
+    using type = typename _zip<
+      typename apply<_pack, L1>::type,
+      typename apply<_pack, L2>::type,
+      make_index_sequence<_min(apply<_pack, L1>::type::size,
+                               apply<_pack, L2>::type::size)>>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Splits a list of pairs
+   *
+   * @tparam L any list of lists of at least two elements
+   *
+   * Provides a member `type` that is a list of two lists: the first
+   * elements of the elements of `L`, and their second elements. The
+   * inverse of @ref zip.
+   */
+  template<list_type L>
+  struct unzip {
+    /// @brief The first elements of the pairs in `L`, and the second
+    using type = typename _unzip<
+      typename apply<_pack, L>::type,
+      make_index_sequence<apply<_pack, L>::type::size>>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Selects the elements of a list that satisfy a predicate
+   *
+   * @tparam P any unary type predicate with a member `value`
+   * convertible to `bool`, for example @ref is_zero
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is the list of all `A` in `L` for
+   * which `P<A>::value` is `true`, in order.
+   *
+   * Every element contributes either itself or nothing to a single
+   * fold expression. Like @ref apply, the instantiation depth grows
+   * with the length of `L` divided by 16.
+   */
+  template<template<typename> typename P, list_type L>
+  struct filter {
+    /// @brief The elements of `L` that satisfy `P`
+    using type = typename apply<_keep_if<P>::template in, L>::type::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  /**
+   * @brief Splits a list by a predicate
+   *
+   * @tparam P any unary type predicate with a member `value`
+   * convertible to `bool`
+   *
+   * @tparam L any list type
+   *
+   * Provides a member `type` that is a list of two lists: the
+   * elements of `L` that satisfy `P`, and those that do not, each in
+   * order. `L` is unpacked only once for both.
+   */
+  template<template<typename> typename P, list_type L>
+  struct partition {
+    /// @brief The elements of `L` that satisfy `P`, and the others
+    using type = _list_of<
+      typename apply<_keep_if<P>::template in, L>::type::type,
+      typename apply<_keep_if<P>::template in, L>::type::rest>;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  ///@}
+} // namespace funcpp
+// End of file
@@ -1,8 +1,12 @@
-export module funcpp:maybe;
+module;
+
+#include "funcpp-config.h"
+
+export module funcpp.maybe;
 
 ///@defgroup funcppMaybe Optional values
 
-import :common;
+export import funcpp.common;
 
 namespace funcpp {
 
@@ -118,7 +122,7 @@ export namespace funcpp {
   struct map<F, _nothing> {
     /// Nothing
     using type = _nothing;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
 
   /**
@@ -144,7 +148,7 @@ export namespace funcpp {
   struct map<F, _some<A>> {
     /// A non-empty list
     using type = _some<typename F<A>::type>;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
 
   /**
@@ -219,7 +223,7 @@ export namespace funcpp {
   template<>
   struct join1<_nothing> {
     using type = _nothing;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
   /// @endcond
 
@@ -227,7 +231,7 @@ export namespace funcpp {
   template<>
   struct join1<_some<_nothing>> {
     using type = _nothing;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
   /// @endcond
 
@@ -235,25 +239,36 @@ export namespace funcpp {
   template<typename A>
   struct join1<_some<_some<A>>> {
     using type = _some<A>;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
   /// @endcond
 
   /**
-   * @brief Inserts a type into a monad
+   * @brief Names the optional monad
+   *
+   * Tag type for @ref pure.
+   */
+  struct maybe {};
+
+  /**
+   * @brief Inserts a type into the optional monad
+   *
+   * @tparam A any type
+   *
+   * Provides a member `type` that holds `A`.
    */
   template<typename A>
-  struct pure {
+  struct pure<maybe, A> {
     /// `A` inserted into the monad
     using type = typename some<A>::type;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
 
   /**
    * @brief Binds monadic operation to a monad
    */
   template<maybe_type MA, template<typename> typename F>
-  struct bind;
+  struct bind<MA, F>;
 
   /**
    * @brief Binds monadic operation to a monad
@@ -262,7 +277,7 @@ export namespace funcpp {
   struct bind<_nothing, F> {
     /// `F` bound to `_nothing`
     using type = _nothing;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
 
   /**
@@ -272,9 +287,38 @@ export namespace funcpp {
   struct bind<_some<A>, F> {
     /// `F` bound to `_some<A>`
     using type = typename F<A>::type;
-    static_assert(maybe_type<type>);
+    FUNCPP_POSTCONDITION(maybe_type<type>);
   };
 
+  /**
+   * @brief Binds a sequence of monadic operations to a monad
+   *
+   * Specialisation of @ref bind_chain for optional types.
+   *
+   * Steps are bound one after the other, until either all steps are
+   * bound, or a step yields nothing. The steps after that are not
+   * instantiated.
+   */
+  template<maybe_type M>
+  struct bind_chain<M> {
+    /// Reproduces `M`
+    using type = M;
+    FUNCPP_POSTCONDITION(maybe_type<type>);
+  };
+
+  /// @cond show_tmpl_spec
+  template<template<typename> typename F, template<typename> typename...Fs>
+  struct bind_chain<_nothing, F, Fs...> {
+    using type = _nothing;
+    FUNCPP_POSTCONDITION(maybe_type<type>);
+  };
+  /// @endcond
+
+  /// @cond show_tmpl_spec
+  template<typename A, template<typename> typename F, template<typename> typename...Fs>
+  struct bind_chain<_some<A>, F, Fs...> : bind_chain<typename F<A>::type, Fs...> {};
+  /// @endcond
+
   ///@}
 } // namespace funcpp
 
@@ -0,0 +1,324 @@
+module;
+
+#include "funcpp-config.h"
+
+export module funcpp.set;
+
+///@defgroup funcppSet Sets over a fixed universe
+
+export import funcpp.list;
+
+namespace funcpp {
+
+  ///@addtogroup funcppSet
+  ///@{
+
+  /// @internal
+  /// @brief Marks `A` as the element at position `I` of a universe
+  template<unsigned long long I, typename A>
+  struct _member {};
+
+  /// @internal
+  /// @brief Deduces the position `I` from the only base `_member<I, A>`
+  template<typename A, unsigned long long I>
+  constexpr unsigned long long _position(_member<I, A> const*) {
+    return I;
+  }
+
+  /// @internal
+  /// @brief Derives from `_member<I, A>` for every `A` at position `I`
+  template<typename Is, typename...As>
+  struct _universe;
+
+  /// @internal
+  template<unsigned long long...Is, typename...As>
+  struct _universe<index_sequence<Is...>, As...> : _member<Is, As>... {
+    static constexpr unsigned long long const size = sizeof...(As);
+
+    /// @brief Number of words of 64 bits needed for `size` bits
+    static constexpr unsigned long long const words = (size + 63) / 64;
+
+    template<typename A>
+    static constexpr bool const has =
+      requires { _position<A>(static_cast<_universe const*>(nullptr)); };
+
+    template<typename A>
+    static constexpr unsigned long long const position =
+      _position<A>(static_cast<_universe const*>(nullptr));
+
+    template<unsigned long long I>
+    using element = typename pack_element<I, As...>::type;
+  };
+
+  /// @internal
+  template<typename...As>
+  using _universe_of_pack = _universe<make_index_sequence<sizeof...(As)>, As...>;
+
+  /// @internal
+  /// @brief The universe of the elements of the list `U`
+  template<typename U>
+  using _universe_of = typename apply<_universe_of_pack, U>::type;
+
+  /// @internal
+  /// @brief `N` words of 64 bits, followed by a word that is always `0`
+  ///
+  /// Bit `i % 64` of word `i / 64` stands for the element at position
+  /// `i` of the universe.
+  template<unsigned long long N>
+  struct _bits {
+    unsigned long long at[N + 1] = {};
+  };
+
+  /// @internal
+  /// @brief The bits of the elements `As` of the universe `V`
+  template<typename V, typename...As>
+  consteval _bits<V::words> _bits_of() {
+    _bits<V::words> b;
+    ((b.at[V::template position<As> / 64] |= 1ull << (V::template position<As> % 64)), ...);
+    return b;
+  }
+
+  /// @internal
+  /// @brief Operations on the bits of two sets
+  enum class _set_operation { unite, intersect, subtract };
+
+  /// @internal
+  /// @brief Combines the bits of `a` and `b` word by word
+  template<_set_operation op, unsigned long long N>
+  consteval _bits<N> _combine(_bits<N> const& a, _bits<N> const& b) {
+    _bits<N> c;
+    for (unsigned long long i = 0; i < N; ++i)
+      c.at[i] = op == _set_operation::unite ? a.at[i] | b.at[i]
+              : op == _set_operation::intersect ? a.at[i] & b.at[i]
+              : a.at[i] & ~b.at[i];
+    return c;
+  }
+
+  /// @internal
+  /// @brief Checks if `A` is in the universe `V` and its bit is set in `a`
+  template<typename A, typename V, unsigned long long N>
+  consteval bool _has_bit(_bits<N> const& a) {
+    if constexpr (V::template has<A>)
+      return (a.at[V::template position<A> / 64] >> (V::template position<A> % 64) & 1) != 0;
+    else
+      return false;
+  }
+
+  /// @internal
+  template<unsigned long long N>
+  consteval unsigned long long _popcount(_bits<N> const& a) {
+    unsigned long long n = 0;
+    for (unsigned long long i = 0; i < N; ++i) n += __builtin_popcountll(a.at[i]);
+    return n;
+  }
+
+  /// @internal
+  /// @brief Positions of `Size` set bits
+  template<unsigned long long Size>
+  struct _set_positions {
+    unsigned long long at[Size + 1] = {};
+  };
+
+  /// @internal
+  /// @brief Positions of the set bits of `a`, in order
+  template<unsigned long long Size, unsigned long long N>
+  consteval _set_positions<Size> _positions(_bits<N> const& a) {
+    _set_positions<Size> p;
+    unsigned long long k = 0;
+    for (unsigned long long i = 0; i < 64 * N; ++i)
+      if (a.at[i / 64] >> (i % 64) & 1) p.at[k++] = i;
+    return p;
+  }
+
+  /// @internal
+  /// @brief The elements of the set `S` over the universe `V`
+  template<typename S, typename V, typename Is>
+  struct _elements;
+
+  /// @internal
+  template<typename S, typename V, unsigned long long...Is>
+  struct _elements<S, V, index_sequence<Is...>> {
+    static constexpr auto const positions = _positions<sizeof...(Is)>(S::bits);
+    using type = typename make_list<
+      typename V::template element<positions.at[Is]>...>::type;
+  };
+
+  ///@}
+} // namespace funcpp
+
+export namespace funcpp {
+
+  ///@addtogroup funcppSet
+  ///@{
+
+  /**
+   * @brief A set of types drawn from a universe
+   *
+   * @tparam U any list of distinct types, the universe
+   *
+   * @tparam bits the members of the set, one bit per element of `U`
+   *
+   * Construct sets with @ref make_set rather than directly. Equal
+   * sets over the same universe are the same type.
+   *
+   * Provides
+   * - `universe`, which reproduces `U`,
+   * - `bits`, which reproduces `bits`.
+   */
+  template<list_type U, _bits<_universe_of<U>::words> b>
+  struct type_set {
+    /// @brief Reproduces the template argument `U`
+    using universe = U;
+    /// @brief Reproduces the template argument `bits`
+    static constexpr auto const& bits = b;
+  };
+
+  /**
+   * @brief Checks if a type is a set
+   *
+   * @tparam A any type
+   */
+  template<typename A>
+  struct is_set : false_type {};
+
+  /// @cond show_tmpl_spec
+  template<typename U, auto b>
+  struct is_set<type_set<U, b>> : true_type {};
+  /// @endcond
+
+  /**
+   * @brief Specifies that a type is a set
+   *
+   * @tparam A any type
+   */
+  template<typename A>
+  concept set_type = is_set<A>::value;
+
+  /**
+   * @brief Constructs a set from a parameter pack
+   *
+   * @tparam U any list of distinct types, the universe
+   *
+   * @tparam As any number of elements of `U`
+   *
+   * Provides a member `type` that is the set of `As`. Every element
+   * is found in `U` by overload resolution, not by a search over `U`.
+   *
+   * **Example:**
+   *
+   *     using U = typename funcpp::make_list<char, short, int, long>::type;
+   *     using S = typename funcpp::make_set<U, char, int>::type;
+   */
+  template<list_type U, typename...As>
+  struct make_set {
+    /// @brief The set of `As`
+    using type = type_set<U, _bits_of<_universe_of<U>, As...>()>;
+    FUNCPP_POSTCONDITION(set_type<type>);
+  };
+
+  /**
+   * @brief Checks if a type is an element of a set
+   *
+   * @tparam A any type
+   *
+   * @tparam S any set type
+   *
+   * Provides the member constant `value` equal to `true` if `A` is
+   * in `S`, and `false` otherwise, including when `A` is not in the
+   * universe of `S`.
+   */
+  template<typename A, set_type S>
+  struct contains : bool_constant<
+    _has_bit<A, _universe_of<typename S::universe>>(S::bits)> {};
+
+  /**
+   * @brief Unites two sets over the same universe
+   *
+   * @tparam S1 any set type
+   *
+   * @tparam S2 any set type with the universe of `S1`
+   *
+   * Provides a member `type` that is the set of the elements of
+   * either `S1` or `S2`. Costs one bitwise or per 64 elements of the
+   * universe.
+   */
+  template<set_type S1, set_type S2>
+    requires refl<typename S1::universe, typename S2::universe>::value
+  struct set_union {
+    /// @brief The elements of `S1` or `S2`
+    using type = type_set<typename S1::universe, _combine<_set_operation::unite>(
+      S1::bits, S2::bits)>;
+  };
+
+  /**
+   * @brief Intersects two sets over the same universe
+   *
+   * @tparam S1 any set type
+   *
+   * @tparam S2 any set type with the universe of `S1`
+   *
+   * Provides a member `type` that is the set of the elements of both
+   * `S1` and `S2`. Costs one bitwise and per 64 elements of the
+   * universe.
+   */
+  template<set_type S1, set_type S2>
+    requires refl<typename S1::universe, typename S2::universe>::value
+  struct set_intersection {
+    /// @brief The elements of `S1` and `S2`
+    using type = type_set<typename S1::universe, _combine<_set_operation::intersect>(
+      S1::bits, S2::bits)>;
+  };
+
+  /**
+   * @brief Subtracts a set from another over the same universe
+   *
+   * @tparam S1 any set type
+   *
+   * @tparam S2 any set type with the universe of `S1`
+   *
+   * Provides a member `type` that is the set of the elements of `S1`
+   * that are not in `S2`. Costs one bitwise and-not per 64 elements
+   * of the universe.
+   */
+  template<set_type S1, set_type S2>
+    requires refl<typename S1::universe, typename S2::universe>::value
+  struct set_difference {
+    /// @brief The elements of `S1` but not `S2`
+    using type = type_set<typename S1::universe, _combine<_set_operation::subtract>(
+      S1::bits, S2::bits)>;
+  };
+
+  /**
+   * @brief Counts the elements of a set
+   *
+   * @tparam S any set type
+   *
+   * Costs one population count per 64 elements of the universe.
+   */
+  template<set_type S>
+  struct count<S> {
+    /// @brief Number of elements in `S`
+    static constexpr unsigned long long const value = _popcount(S::bits);
+  };
+
+  /**
+   * @brief Lists the elements of a set
+   *
+   * @tparam S any set type
+   *
+   * Provides a member `type` that is the list of the elements of
+   * `S`, in the order of the universe.
+   */
+  template<set_type S>
+  struct elements {
+    /// @brief The elements of `S`
+    using type = typename _elements<
+      S, _universe_of<typename S::universe>,
+      make_index_sequence<count<S>::value>>::type;
+    FUNCPP_POSTCONDITION(list_type<type>);
+  };
+
+  ///@}
+} // namespace funcpp
+
+// End of file
@@ -0,0 +1,310 @@
+export module funcpp.stream;
+
+///@defgroup funcppStream Streams of values at run time
+
+namespace funcpp::stream {
+
+  ///@addtogroup funcppStream
+  ///@{
+
+  /// @internal
+  /// @brief Names a value of type `A` in unevaluated operands
+  template<typename A>
+  A&& _declval() noexcept;
+
+  /// @internal
+  /// @brief Room for one object of type `A`, without the heap
+  ///
+  /// Constructs the object in place with a class-specific placement
+  /// allocation function, so that no header is needed.
+  template<typename A>
+  struct _slot {
+    struct box {
+      A a;
+      static void* operator new(decltype(sizeof 0), void* p) noexcept { return p; }
+      static void operator delete(void*, void*) noexcept {}
+    };
+
+    alignas(box) unsigned char bytes[sizeof(box)];
+    box* p = nullptr;
+
+    _slot() noexcept = default;
+
+    _slot(_slot const& other) {
+      if (other.p) emplace([&] { return other.p->a; });
+    }
+
+    _slot(_slot&& other) {
+      if (other.p) emplace([&] { return static_cast<A&&>(other.p->a); });
+    }
+
+    _slot& operator=(_slot const&) = delete;
+
+    ~_slot() { reset(); }
+
+    /// @brief Replaces the object with the result of `make()`
+    template<typename F>
+    void emplace(F&& make) {
+      reset();
+      p = new (bytes) box{make()};
+    }
+
+    void reset() noexcept {
+      if (p) p->~box();
+      p = nullptr;
+    }
+  };
+
+  /// @internal
+  /// @brief The elements from `first` up to `last`
+  template<typename I, typename E>
+  struct _iterator_stream {
+    using value_type = decltype(*_declval<I&>());
+
+    I first;
+    E last;
+
+    template<typename K>
+    constexpr bool next(K&& k) {
+      if (first == last) return false;
+      k(*first);
+      ++first;
+      return true;
+    }
+  };
+
+  /// @internal
+  template<typename F, typename S>
+  struct _map_stream {
+    using value_type = decltype(_declval<F&>()(_declval<typename S::value_type>()));
+
+    F f;
+    S s;
+
+    template<typename K>
+    constexpr bool next(K&& k) {
+      return s.next([&](auto&& a) { k(f(static_cast<decltype(a)&&>(a))); });
+    }
+  };
+
+  /// @internal
+  template<typename P, typename S>
+  struct _filter_stream {
+    using value_type = typename S::value_type;
+
+    P p;
+    S s;
+
+    template<typename K>
+    constexpr bool next(K&& k) {
+      bool found = false;
+      while (not found) {
+        bool const more = s.next([&](auto&& a) {
+          if (p(static_cast<decltype(a) const&>(a))) {
+            found = true;
+            k(static_cast<decltype(a)&&>(a));
+          }
+        });
+        if (not more) return false;
+      }
+      return true;
+    }
+  };
+
+  /// @internal
+  template<typename S>
+  struct _take_stream {
+    using value_type = typename S::value_type;
+
+    unsigned long long n;
+    S s;
+
+    template<typename K>
+    constexpr bool next(K&& k) {
+      if (n == 0) return false;
+      --n;
+      return s.next(k);
+    }
+  };
+
+  /// @internal
+  /// @brief Runs through the stream `f(a)` for every element `a` of `S`
+  template<typename S, typename F>
+  struct _bind_stream {
+    using inner_type = decltype(_declval<F&>()(_declval<typename S::value_type>()));
+    using value_type = typename inner_type::value_type;
+
+    S s;
+    F f;
+    _slot<inner_type> inner = {};
+
+    template<typename K>
+    bool next(K&& k) {
+      for (;;) {
+        if (inner.p and inner.p->a.next(k)) return true;
+        bool const more = s.next([&](auto&& a) {
+          inner.emplace([&] { return f(static_cast<decltype(a)&&>(a)); });
+        });
+        if (not more) return false;
+      }
+    }
+  };
+
+  ///@}
+} // namespace funcpp::stream
+
+/**
+ * @brief Streams of values at run time
+ *
+ * A stream yields its elements one at a time, on demand. Its member
+ * function `next(k)` passes the next element to `k` and returns
+ * `true`, or returns `false` when the stream is exhausted. Its
+ * member `value_type` is the type of the elements it passes.
+ *
+ * The adaptors are named after their type-level counterparts, and
+ * take their arguments in the same order. Each adaptor holds its
+ * source by value and calls it directly, so a chain of adaptors
+ * compiles into a single loop. No adaptor buffers elements or
+ * allocates memory on the heap.
+ *
+ * **Example:**
+ *
+ *     namespace s = funcpp::stream;
+ *     auto const total = s::fold(plus, 0,
+ *       s::take(10, s::filter(is_error, s::map(parse, s::from(lines)))));
+ */
+export namespace funcpp::stream {
+
+  ///@addtogroup funcppStream
+  ///@{
+
+  /**
+   * @brief The stream of the elements from `first` up to `last`
+   *
+   * @param first any input iterator
+   *
+   * @param last an iterator or sentinel that compares with `first`
+   */
+  template<typename I, typename E>
+  constexpr auto from(I first, E last) {
+    return _iterator_stream<I, E>{first, last};
+  }
+
+  /**
+   * @brief The stream of the elements of an array
+   *
+   * @param a any array
+   */
+  template<typename A, unsigned long long N>
+  constexpr auto from(A (&a)[N]) {
+    return from(a + 0, a + N);
+  }
+
+  /**
+   * @brief The stream of the elements of a range
+   *
+   * @param r any range with member functions `begin()` and `end()`
+   *
+   * The stream refers to `r`, which must outlive it.
+   */
+  template<typename R>
+    requires requires (R& r) { r.begin(); r.end(); }
+  constexpr auto from(R& r) {
+    return from(r.begin(), r.end());
+  }
+
+  /**
+   * @brief Maps a function over a stream
+   *
+   * @param f any function that accepts the elements of `s`
+   *
+   * @param s any stream
+   *
+   * Yields `f(a)` for every element `a` of `s`.
+   */
+  template<typename F, typename S>
+  constexpr auto map(F f, S s) {
+    return _map_stream<F, S>{static_cast<F&&>(f), static_cast<S&&>(s)};
+  }
+
+  /**
+   * @brief Selects the elements of a stream that satisfy a predicate
+   *
+   * @param p any function from the elements of `s` to `bool`
+   *
+   * @param s any stream
+   *
+   * Yields every element `a` of `s` for which `p(a)` is `true`.
+   */
+  template<typename P, typename S>
+  constexpr auto filter(P p, S s) {
+    return _filter_stream<P, S>{static_cast<P&&>(p), static_cast<S&&>(s)};
+  }
+
+  /**
+   * @brief Takes the first elements of a stream
+   *
+   * @param n number of elements
+   *
+   * @param s any stream
+   *
+   * Yields the first `n` elements of `s`. Never pulls more than `n`
+   * elements from `s`, so `s` may be endless.
+   */
+  template<typename S>
+  constexpr auto take(unsigned long long n, S s) {
+    return _take_stream<S>{n, static_cast<S&&>(s)};
+  }
+
+  /**
+   * @brief Binds a function that yields streams to a stream
+   *
+   * @param s any stream
+   *
+   * @param f any function from the elements of `s` to streams
+   *
+   * Yields the elements of `f(a)` for every element `a` of `s`, in
+   * order. Holds only the stream `f(a)` of the current `a`, in place.
+   */
+  template<typename S, typename F>
+  auto bind(S s, F f) {
+    return _bind_stream<S, F>{static_cast<S&&>(s), static_cast<F&&>(f)};
+  }
+
+  /**
+   * @brief Flattens a stream of ranges
+   *
+   * @param s any stream of ranges, passed as lvalues
+   *
+   * Yields the elements of every element of `s`, in order.
+   */
+  template<typename S>
+  auto join1(S s) {
+    return bind(static_cast<S&&>(s), [](auto& r) { return from(r); });
+  }
+
+  /**
+   * @brief Reduces a stream
+   *
+   * @param f any function from an accumulator and an element of `s`
+   * to an accumulator
+   *
+   * @param acc the initial accumulator
+   *
+   * @param s any stream
+   *
+   * Pulls every element `a` of `s` in turn, replaces `acc` with
+   * `f(acc, a)`, and returns the final `acc`.
+   */
+  template<typename F, typename Acc, typename S>
+  constexpr Acc fold(F f, Acc acc, S s) {
+    while (s.next([&](auto&& a) {
+      acc = f(static_cast<Acc&&>(acc), static_cast<decltype(a)&&>(a));
+    })) {}
+    return acc;
+  }
+
+  ///@}
+} // namespace funcpp::stream
+
+// End of file
@@ -0,0 +1,139 @@
+import funcpp.backend;
+
+using namespace funcpp;
+
+// Reference implementations by template recursion over the list, to
+// compare against the constant evaluation backend.
+namespace reference {
+  template<bool c, typename A, typename B> struct if_ { using type = A; };
+  template<typename A, typename B> struct if_<false, A, B> { using type = B; };
+
+  template<typename L> struct is_nil : refl<L, nil::type> {};
+
+  template<template<typename> typename P, typename L, bool = is_nil<L>::value>
+  struct filter { using type = nil::type; };
+
+  template<template<typename> typename P, typename L>
+  struct filter<P, L, false> {
+    using rest = typename filter<P, typename L::cdr>::type;
+    using type = typename if_<
+      P<typename L::car>::value,
+      typename cons<typename L::car, rest>::type,
+      rest>::type;
+  };
+
+  template<typename A, typename L, bool = is_nil<L>::value>
+  struct index_of : constant<unsigned long long, 0> {};
+
+  template<typename A, typename L>
+  struct index_of<A, L, false> : constant<
+    unsigned long long,
+    refl<A, typename L::car>::value ? 0 : 1 + index_of<A, typename L::cdr>::value> {};
+
+  template<typename A> struct is_not {
+    template<typename B> struct same : bool_constant<not refl<A, B>::value> {};
+  };
+
+  template<typename L, bool = is_nil<L>::value>
+  struct unique { using type = nil::type; };
+
+  template<typename L>
+  struct unique<L, false> {
+    using type = typename cons<
+      typename L::car,
+      typename unique<typename filter<
+        is_not<typename L::car>::template same,
+        typename L::cdr>::type>::type>::type;
+  };
+
+  // Insertion sort, stable
+  template<template<typename> typename K, typename A, typename L, bool = is_nil<L>::value>
+  struct insert { using type = typename cons<A, L>::type; };
+
+  template<template<typename> typename K, typename A, typename L>
+  struct insert<K, A, L, false> {
+    using type = typename if_<
+      (K<typename L::car>::value < K<A>::value),
+      typename cons<typename L::car, typename insert<K, A, typename L::cdr>::type>::type,
+      typename cons<A, L>::type>::type;
+  };
+
+  template<template<typename> typename K, typename L, bool = is_nil<L>::value>
+  struct sort { using type = nil::type; };
+
+  template<template<typename> typename K, typename L>
+  struct sort<K, L, false> {
+    using type = typename insert<K, typename L::car, typename sort<K, typename L::cdr>::type>::type;
+  };
+} // namespace reference
+
+template<typename...As> struct length : constant<unsigned long long, sizeof...(As)> {};
+template<typename A> struct size_of : constant<unsigned long long, sizeof(A)> {};
+template<typename A> struct is_small : bool_constant<(sizeof(A) < 4)> {};
+template<typename A> struct is_odd : bool_constant<A::value % 2 == 1> {};
+template<typename A> struct descending : constant<long long, -static_cast<long long>(A::value)> {};
+
+using Types = make_list<
+  long, char, int, short, char, double, long long, float,
+  int, void*, bool, short, long double, char, unsigned>::type;
+
+namespace test_backend_filter {
+  static_assert(refl<backend::filter<is_small, Types>::type,
+                     reference::filter<is_small, Types>::type>::value);
+  static_assert(refl<backend::filter<is_small, nil::type>::type, nil::type>::value);
+  using R = range<40>::type;
+  static_assert(refl<backend::filter<is_odd, R>::type,
+                     reference::filter<is_odd, R>::type>::value);
+}
+
+namespace test_backend_partition {
+  using P = backend::partition<is_small, Types>::type;
+  static_assert(refl<P::car, reference::filter<is_small, Types>::type>::value);
+  template<typename A> struct is_large : bool_constant<not is_small<A>::value> {};
+  static_assert(refl<P::cdr::car, reference::filter<is_large, Types>::type>::value);
+  static_assert(refl<P::cdr::cdr, nil::type>::value);
+}
+
+namespace test_backend_index_of {
+  template<typename A>
+  constexpr bool same_index =
+    backend::index_of<A, Types>::type::value == reference::index_of<A, Types>::value;
+  static_assert(same_index<long>);
+  static_assert(same_index<char>);
+  static_assert(same_index<unsigned>);
+  static_assert(same_index<void>);
+  static_assert(backend::index_of<void, Types>::type::value == count<Types>::value);
+}
+
+namespace test_backend_unique {
+  static_assert(refl<backend::unique<Types>::type, reference::unique<Types>::type>::value);
+  static_assert(refl<backend::unique<nil::type>::type, nil::type>::value);
+  static_assert(refl<backend::unique<repeat<50, int>::type>::type, make_list<int>::type>::value);
+}
+
+namespace test_backend_sort {
+  static_assert(refl<backend::sort<size_of, Types>::type,
+                     reference::sort<size_of, Types>::type>::value);
+  using R = range<40>::type;
+  static_assert(refl<backend::sort<descending, R>::type,
+                     reference::sort<descending, R>::type>::value);
+  static_assert(refl<backend::sort<size_of, nil::type>::type, nil::type>::value);
+}
+
+namespace test_backend_long_lists {
+  // Far beyond the instantiation depth of the recursive references
+  using R = range<3000>::type;
+  using Odd = backend::filter<is_odd, R>::type;
+  static_assert(apply<length, backend::sort<descending, Odd>::type>::type::value == 1500);
+  static_assert(refl<backend::sort<descending, Odd>::type::car,
+                     constant<unsigned long long, 2999>>::value);
+  static_assert(backend::index_of<constant<unsigned long long, 2999>, R>::type::value == 2999);
+  static_assert(refl<backend::unique<R>::type, R>::value);
+  template<typename...As> struct twice : make_list<As..., As...> {};
+  using Twice = apply<twice, R>::type::type;
+  static_assert(refl<backend::unique<Twice>::type, R>::value);
+  static_assert(refl<backend::unique<repeat<3000, int>::type>::type, make_list<int>::type>::value);
+}
+
+int main() {
+}
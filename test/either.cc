@@ -0,0 +1,65 @@
+import funcpp.either;
+
+// Declared, but never defined. Instantiating a step with it fails.
+template<typename A> struct undefined_step;
+
+namespace test_either_classification {
+  using namespace funcpp;
+  using E = left<int>::type;
+  using R = right<char>::type;
+  static_assert(either_type<E>);
+  static_assert(either_type<R>);
+  static_assert(not either_type<int>);
+  static_assert(count<E>::value == 0);
+  static_assert(count<R>::value == 1);
+}
+
+namespace test_either_map {
+  using namespace funcpp;
+  template<typename A> struct pointer { using type = A*; };
+  static_assert(refl<map<pointer, right<int>::type>::type, right<int*>::type>::value);
+  static_assert(refl<map<pointer, left<int>::type>::type, left<int>::type>::value);
+}
+
+namespace test_either_fold {
+  using namespace funcpp;
+  template<typename Acc, typename A> struct second { using type = A; };
+  static_assert(refl<fold<second, void, right<int>::type>::type, int>::value);
+  static_assert(refl<fold<second, void, left<int>::type>::type, void>::value);
+}
+
+namespace test_either_join {
+  using namespace funcpp;
+  using R = right<int>::type;
+  using E = left<char>::type;
+  static_assert(refl<join1<right<R>::type>::type, R>::value);
+  static_assert(refl<join1<right<E>::type>::type, E>::value);
+  static_assert(refl<join1<E>::type, E>::value);
+}
+
+namespace test_either_monad {
+  using namespace funcpp;
+  struct too_small {};
+  template<typename A> struct check_size {
+    using type = typename right<A>::type;
+  };
+  template<> struct check_size<char> {
+    using type = left<too_small>::type;
+  };
+  template<typename A> struct pointer {
+    using type = typename right<A*>::type;
+  };
+  static_assert(refl<pure<either, int>::type, right<int>::type>::value);
+  static_assert(refl<bind<right<int>::type, pointer>::type, right<int*>::type>::value);
+  static_assert(refl<bind<left<int>::type, pointer>::type, left<int>::type>::value);
+
+  using R = bind_chain<right<int>::type, check_size, pointer, pointer>::type;
+  static_assert(refl<R, right<int**>::type>::value);
+  // The chain stops at the error; undefined_step is never instantiated
+  using E = bind_chain<right<char>::type, check_size, undefined_step, undefined_step>::type;
+  static_assert(refl<E, left<too_small>::type>::value);
+  static_assert(refl<bind_chain<right<int>::type>::type, right<int>::type>::value);
+}
+
+int main() {
+}
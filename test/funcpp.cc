@@ -0,0 +1,23 @@
+import funcpp;
+
+namespace test_umbrella_pure {
+  using namespace funcpp;
+  // Each monad provides its own pure, selected by its tag type
+  static_assert(refl<pure<list, int>::type, make_list<int>::type>::value);
+  static_assert(refl<pure<maybe, int>::type, some<int>::type>::value);
+  static_assert(refl<pure<either, int>::type, right<int>::type>::value);
+}
+
+namespace test_umbrella_bind {
+  using namespace funcpp;
+  template<typename A> struct as_list { using type = make_list<A>::type; };
+  template<typename A> struct as_some { using type = some<A>::type; };
+  using L = make_list<char, int>::type;
+  static_assert(refl<bind<L, as_list>::type, L>::value);
+  using M = some<int>::type;
+  static_assert(refl<bind<M, as_some>::type, M>::value);
+  static_assert(refl<bind<nothing::type, as_some>::type, nothing::type>::value);
+}
+
+int main() {
+}
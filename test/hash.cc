@@ -0,0 +1,67 @@
+import funcpp.hash;
+
+namespace test_hash_integer_keys {
+  using namespace funcpp;
+  using K = make_list<
+    constant<unsigned long long, 7>,
+    constant<unsigned long long, 42>,
+    constant<unsigned long long, 1000003>,
+    constant<unsigned long long, 0>>::type;
+  using H = perfect_hash<K>;
+  static_assert(H::size == 4);
+  static_assert(H::find(7) == 0);
+  static_assert(H::find(42) == 1);
+  static_assert(H::find(1000003) == 2);
+  static_assert(H::find(0) == 3);
+  static_assert(H::find(8) == H::miss);
+  static_assert(H::find(43) == H::miss);
+}
+
+namespace test_hash_empty {
+  using namespace funcpp;
+  using H = perfect_hash<nil::type>;
+  static_assert(H::size == 0);
+  static_assert(H::find(0) == H::miss);
+  static_assert(H::find(1) == H::miss);
+}
+
+namespace test_hash_many_keys {
+  using namespace funcpp;
+  using H = perfect_hash<range<200>::type>;
+  constexpr bool all_found() {
+    for (unsigned long long i = 0; i < 200; ++i)
+      if (H::find(i) != i) return false;
+    return H::find(200) == H::miss;
+  }
+  static_assert(all_found());
+}
+
+namespace test_hash_string_keys {
+  using namespace funcpp;
+  using K = make_list<
+    string_key<"accept">,
+    string_key<"content-length">,
+    string_key<"content-type">,
+    string_key<"host">>::type;
+  using H = perfect_hash<K>;
+  static_assert(H::find("accept", 6) == 0);
+  static_assert(H::find("host", 4) == 3);
+  static_assert(H::find("hos", 3) == H::miss);
+  static_assert(H::find(string_key<"content-type">::value) == 2);
+}
+
+int main() {
+  using namespace funcpp;
+  using H = perfect_hash<make_list<
+    string_key<"accept">,
+    string_key<"content-length">,
+    string_key<"content-type">,
+    string_key<"host">>::type>;
+  char const request[] = "GET / HTTP/1.1 host content-type user-agent";
+  int err = 0;
+  ++err; if (H::find(request + 15, 4) != 3) return err;
+  ++err; if (H::find(request + 20, 12) != 2) return err;
+  ++err; if (H::find(request + 33, 10) != H::miss) return err;
+  ++err; if (H::find(request, 0) != H::miss) return err;
+  return 0;
+}
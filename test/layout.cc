@@ -0,0 +1,60 @@
+import funcpp.layout;
+
+using namespace funcpp;
+
+namespace test_layout_offsets {
+  using L = layout<make_list<char, int, short, double, char>::type>;
+  static_assert(L::fields == 5);
+  static_assert(L::offset<0> == 0);
+  static_assert(L::offset<1> == 4);
+  static_assert(L::offset<2> == 8);
+  static_assert(L::offset<3> == 16);
+  static_assert(L::offset<4> == 24);
+  static_assert(L::alignment == alignof(double));
+  static_assert(L::size == 32);
+  static_assert(refl<L::field<3>, double>::value);
+}
+
+namespace test_layout_like_struct {
+  struct S { char a; long b; short c[3]; };
+  using L = layout<make_list<char, long, short[3]>::type>;
+  static_assert(L::size == sizeof(S));
+  static_assert(L::alignment == alignof(S));
+  static_assert(L::offset<1> == __builtin_offsetof(S, b));
+  static_assert(L::offset<2> == __builtin_offsetof(S, c));
+}
+
+namespace test_layout_empty {
+  using L = layout<nil::type>;
+  static_assert(L::fields == 0);
+  static_assert(L::size == 0);
+  static_assert(L::alignment == 1);
+}
+
+namespace test_layout_round_trip {
+  struct point { int x, y; };
+  using L = make_list<unsigned char, unsigned, point, double, short>::type;
+  using S = serialize<L>;
+
+  bool run() {
+    unsigned char buffer[S::size + 1];
+    for (auto& b : buffer) b = 0xff;
+    S::write(buffer + 1, 'x', 0x01020304u, point{-5, 7}, 2.5, -3);
+    view<L> const v{buffer + 1};
+    auto const p = v.get<2>();
+    bool ok = v.get<0>() == 'x' and v.get<1>() == 0x01020304u and
+      p.x == -5 and p.y == 7 and v.get<3>() == 2.5 and v.get<4>() == -3;
+    // Little endian on the wire
+    ok = ok and buffer[1 + S::offset<1>] == 0x04 and buffer[1 + S::offset<1> + 3] == 0x01;
+    // Padding is zeroed
+    ok = ok and buffer[1 + 1] == 0 and buffer[1 + S::size - 1] == 0;
+    unsigned char copy[S::size];
+    S::copy(copy, v);
+    ok = ok and view<L>{copy}.get<1>() == 0x01020304u;
+    return ok;
+  }
+}
+
+int main() {
+  return test_layout_round_trip::run() ? 0 : 1;
+}
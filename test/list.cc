@@ -1,4 +1,4 @@
-import funcpp;
+import funcpp.list;
 
 #define NIL       typename nil::type
 #define CONS(A,B) typename cons<A,B>::type
@@ -69,5 +69,134 @@ namespace test_list_join {
   static_assert(refl<Lx, L>::value);
 }
 
+namespace test_list_monad {
+  using namespace funcpp;
+  template<typename A> struct twice {
+    using type = make_list<A, A>::type;
+  };
+  static_assert(refl<pure<list, int>::type, CONS(int, NIL)>::value);
+  using L = bind<make_list<char, int>::type, twice>::type;
+  static_assert(refl<L, make_list<char, char, int, int>::type>::value);
+  static_assert(refl<bind<NIL, twice>::type, NIL>::value);
+}
+
+namespace test_list_range {
+  using namespace funcpp;
+  using L0 = range<0>::type;
+  static_assert(refl<L0, NIL>::value);
+  using L3 = range<3>::type;
+  using Lx = make_list<
+    constant<unsigned long long, 0>,
+    constant<unsigned long long, 1>,
+    constant<unsigned long long, 2>>::type;
+  static_assert(refl<L3, Lx>::value);
+  static_assert(count<range<100>::type>::value == 100);
+}
+
+namespace test_list_repeat {
+  using namespace funcpp;
+  static_assert(refl<repeat<0, int>::type, NIL>::value);
+  using L3 = repeat<3, int>::type;
+  static_assert(refl<L3, make_list<int, int, int>::type>::value);
+  static_assert(count<repeat<100, void>::type>::value == 100);
+}
+
+namespace test_list_classification_depth {
+  using namespace funcpp;
+  // Longer than the default template instantiation depth of any
+  // compiler; classification must not recurse over the list.
+  using L = range<2000>::type;
+  static_assert(list_type<L>);
+  static_assert(list_type<CONS(int, L)>);
+}
+
+namespace test_list_apply {
+  using namespace funcpp;
+  template<typename...As> struct size : constant<unsigned long long, sizeof...(As)> {};
+  static_assert(apply<size, NIL>::type::value == 0);
+  static_assert(apply<size, range<1000>::type>::type::value == 1000);
+  using L = make_list<char, short, int>::type;
+  static_assert(refl<apply<make_list, L>::type, make_list<char, short, int>>::value);
+  using R = range<37>::type;
+  static_assert(refl<apply<make_list, R>::type::type, R>::value);
+}
+
+namespace test_list_product {
+  using namespace funcpp;
+  using L1 = make_list<char, int>::type;
+  using L2 = make_list<float, double, void>::type;
+  using L3 = make_list<short, long>::type;
+  using P = product<L1, L2>::type;
+  using Px = make_list<
+    make_list<char, float>::type,
+    make_list<char, double>::type,
+    make_list<char, void>::type,
+    make_list<int, float>::type,
+    make_list<int, double>::type,
+    make_list<int, void>::type>::type;
+  static_assert(refl<P, Px>::value);
+  // Same as nested bind
+  template<typename A> struct with_l3 {
+    template<typename B> struct pair { using type = make_list<typename make_list<A, B>::type>::type; };
+    using type = bind<L3, pair>::type;
+  };
+  static_assert(refl<product<L1, L3>::type, bind<L1, with_l3>::type>::value);
+  static_assert(count<product<L1, L2, L3>::type>::value == 12);
+  static_assert(refl<product<L1, L2, L3>::type::cdr::car, make_list<char, float, long>::type>::value);
+  static_assert(refl<product<L1, NIL, L3>::type, NIL>::value);
+  static_assert(refl<product<>::type, make_list<NIL>::type>::value);
+  using Pr = product<range<20>::type, range<30>::type>::type;
+  static_assert(count<Pr>::value == 600);
+  static_assert(refl<Pr::cdr::car, make_list<constant<unsigned long long, 0>,
+                                             constant<unsigned long long, 1>>::type>::value);
+}
+
+namespace test_list_take_drop {
+  using namespace funcpp;
+  using L = make_list<char, short, int, long>::type;
+  static_assert(refl<take<0, L>::type, NIL>::value);
+  static_assert(refl<take<2, L>::type, make_list<char, short>::type>::value);
+  static_assert(refl<take<9, L>::type, L>::value);
+  static_assert(refl<drop<0, L>::type, L>::value);
+  static_assert(refl<drop<3, L>::type, make_list<long>::type>::value);
+  static_assert(refl<drop<9, L>::type, NIL>::value);
+  static_assert(refl<take<3, NIL>::type, NIL>::value);
+  using S = split_at<1, L>::type;
+  static_assert(refl<S, make_list<make_list<char>::type,
+                                  make_list<short, int, long>::type>::type>::value);
+  using R = range<1000>::type;
+  static_assert(refl<drop<999, R>::type::car, constant<unsigned long long, 999>>::value);
+  static_assert(refl<take<600, R>::type, apply<make_list, take<600, R>::type>::type::type>::value);
+  static_assert(count<take<500, drop<250, R>::type>::type>::value == 500);
+}
+
+namespace test_list_zip {
+  using namespace funcpp;
+  using L1 = make_list<char, short, int>::type;
+  using L2 = make_list<float, double>::type;
+  using Z = zip<L1, L2>::type;
+  static_assert(refl<Z, make_list<make_list<char, float>::type,
+                                  make_list<short, double>::type>::type>::value);
+  static_assert(refl<zip<L1, NIL>::type, NIL>::value);
+  using U = unzip<Z>::type;
+  static_assert(refl<U, make_list<take<2, L1>::type, L2>::type>::value);
+  static_assert(refl<unzip<NIL>::type, make_list<NIL, NIL>::type>::value);
+}
+
+namespace test_list_filter {
+  using namespace funcpp;
+  template<typename A> struct is_small : bool_constant<(sizeof(A) < 4)> {};
+  template<typename A> struct is_large : bool_constant<not is_small<A>::value> {};
+  using L = make_list<char, long, short, double, bool>::type;
+  static_assert(refl<filter<is_small, L>::type, make_list<char, short, bool>::type>::value);
+  static_assert(refl<filter<is_small, NIL>::type, NIL>::value);
+  using P = partition<is_small, L>::type;
+  static_assert(refl<P, make_list<filter<is_small, L>::type,
+                                  filter<is_large, L>::type>::type>::value);
+  using R = range<2000>::type;
+  static_assert(count<filter<is_zero, R>::type>::value == 1);
+  static_assert(refl<partition<is_zero, R>::type::cdr::car, drop<1, R>::type>::value);
+}
+
 int main() {
 }
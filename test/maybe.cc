@@ -1,7 +1,22 @@
-import funcpp;
+import funcpp.maybe;
 
 using namespace funcpp;
 
+// Declared, but never defined. Instantiating a step with it fails.
+template<typename A> struct undefined_step;
+
+namespace test_maybe_bind_chain {
+  template<typename A> struct pointer { using type = typename some<A*>::type; };
+  template<typename A> struct reject { using type = nothing::type; };
+  using S = bind_chain<some<int>::type, pointer, pointer>::type;
+  static_assert(refl<S, some<int**>::type>::value);
+  // The chain stops at nothing; undefined_step is never instantiated
+  using N = bind_chain<some<int>::type, pointer, reject, undefined_step>::type;
+  static_assert(refl<N, nothing::type>::value);
+  static_assert(refl<bind_chain<nothing::type, undefined_step>::type, nothing::type>::value);
+  static_assert(refl<bind_chain<some<int>::type>::type, some<int>::type>::value);
+}
+
 template<typename A>
 class maybe_var {
   using n_type = typename nothing::type;
@@ -0,0 +1,51 @@
+import funcpp.set;
+
+using namespace funcpp;
+
+using U = make_list<char, short, int, long, float, double>::type;
+
+namespace test_set_construction {
+  using S = make_set<U, int, char>::type;
+  static_assert(set_type<S>);
+  static_assert(not set_type<U>);
+  static_assert(refl<S, make_set<U, char, int, char>::type>::value);
+  static_assert(not refl<S, make_set<U, char>::type>::value);
+  static_assert(count<S>::value == 2);
+  static_assert(count<make_set<U>::type>::value == 0);
+  static_assert(refl<elements<S>::type, make_list<char, int>::type>::value);
+}
+
+namespace test_set_contains {
+  using S = make_set<U, short, double>::type;
+  static_assert(contains<short, S>::value);
+  static_assert(contains<double, S>::value);
+  static_assert(not contains<int, S>::value);
+  static_assert(not contains<void, S>::value);
+}
+
+namespace test_set_operations {
+  using A = make_set<U, char, short, int>::type;
+  using B = make_set<U, int, long, float>::type;
+  static_assert(refl<set_union<A, B>::type,
+                     make_set<U, char, short, int, long, float>::type>::value);
+  static_assert(refl<set_intersection<A, B>::type, make_set<U, int>::type>::value);
+  static_assert(refl<set_difference<A, B>::type, make_set<U, char, short>::type>::value);
+  static_assert(refl<elements<set_difference<B, A>::type>::type,
+                     make_list<long, float>::type>::value);
+}
+
+namespace test_set_large_universe {
+  using R = range<200>::type;
+  template<unsigned long long I> using n = constant<unsigned long long, I>;
+  using A = make_set<R, n<0>, n<63>, n<64>, n<130>, n<199>>::type;
+  using B = make_set<R, n<63>, n<130>, n<150>>::type;
+  static_assert(count<A>::value == 5);
+  static_assert(count<set_union<A, B>::type>::value == 6);
+  static_assert(refl<elements<set_intersection<A, B>::type>::type,
+                     make_list<n<63>, n<130>>::type>::value);
+  static_assert(contains<n<199>, A>::value);
+  static_assert(not contains<n<150>, A>::value);
+}
+
+int main() {
+}
@@ -0,0 +1,62 @@
+import funcpp.stream;
+
+namespace s = funcpp::stream;
+
+constexpr auto plus = [](int acc, int a) { return acc + a; };
+constexpr auto is_odd = [](int a) { return a % 2 != 0; };
+constexpr auto square = [](int a) { return a * a; };
+
+namespace test_stream_fold {
+  constexpr int xs[] = {1, 2, 3, 4, 5, 6, 7};
+  static_assert(s::fold(plus, 0, s::from(xs)) == 28);
+  static_assert(s::fold(plus, 0, s::map(square, s::from(xs))) == 140);
+  static_assert(s::fold(plus, 0, s::filter(is_odd, s::from(xs))) == 16);
+  static_assert(s::fold(plus, 0, s::take(3, s::from(xs))) == 6);
+  static_assert(s::fold(plus, 0, s::take(0, s::from(xs))) == 0);
+  static_assert(s::fold(plus, 0, s::take(3, s::map(square, s::filter(is_odd, s::from(xs))))) == 35);
+}
+
+namespace test_stream_endless {
+  // Counts up forever; take must not pull past its limit
+  struct naturals {
+    using value_type = int;
+    int n = 0;
+    template<typename K>
+    constexpr bool next(K&& k) { k(n++); return true; }
+  };
+  static_assert(s::fold(plus, 0, s::take(4, naturals{})) == 6);
+  static_assert(s::fold(plus, 0, s::take(3, s::filter(is_odd, naturals{}))) == 9);
+}
+
+namespace test_stream_bind {
+  struct row {
+    int cells[3];
+    int n;
+    int const* begin() const { return cells; }
+    int const* end() const { return cells + n; }
+  };
+
+  bool run() {
+    row const rows[] = {{{1, 2, 3}, 3}, {{}, 0}, {{4, 5}, 2}};
+    bool ok = s::fold(plus, 0, s::join1(s::from(rows))) == 15;
+    // Every element a of 1, 2, 3 yields the first a squares
+    int const xs[] = {1, 2, 3};
+    int const ys[] = {1, 4, 9};
+    auto const squares = s::bind(s::from(xs), [&](int a) {
+      return s::take(a, s::from(ys));
+    });
+    ok = ok and s::fold(plus, 0, squares) == 1 + (1 + 4) + (1 + 4 + 9);
+    ok = ok and s::fold(plus, 0, s::take(4, s::bind(s::from(xs), [&](int a) {
+      return s::map(square, s::take(a, s::from(xs)));
+    }))) == 1 + (1 + 4) + 1;
+    auto const count = [](int acc, int) { return acc + 1; };
+    ok = ok and s::fold(count, 0, s::bind(s::from(rows), [](row const& r) {
+      return s::filter(is_odd, s::from(r));
+    })) == 3;
+    return ok;
+  }
+}
+
+int main() {
+  return test_stream_bind::run() ? 0 : 1;
+}